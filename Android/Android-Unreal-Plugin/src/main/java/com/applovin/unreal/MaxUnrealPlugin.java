@@ -1,7 +1,9 @@
 package com.applovin.unreal;
 
 import android.app.Activity;
+import android.content.ComponentCallbacks2;
 import android.content.Context;
+import android.content.res.Configuration;
 import android.content.pm.PackageManager;
 import android.graphics.Color;
 import android.graphics.Rect;
@@ -23,6 +25,7 @@ import com.applovin.mediation.MaxAdListener;
 import com.applovin.mediation.MaxAdRevenueListener;
 import com.applovin.mediation.MaxAdViewAdListener;
 import com.applovin.mediation.MaxError;
+import com.applovin.mediation.MaxNetworkResponseInfo;
 import com.applovin.mediation.MaxReward;
 import com.applovin.mediation.MaxRewardedAdListener;
 import com.applovin.mediation.ads.MaxAdView;
@@ -39,15 +42,20 @@ import com.applovin.sdk.AppLovinSdkInitializationConfiguration;
 import com.applovin.sdk.AppLovinSdkSettings;
 import com.applovin.sdk.AppLovinSdkUtils;
 
+import org.json.JSONArray;
 import org.json.JSONObject;
 
 import java.lang.ref.WeakReference;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
 import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Collections;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
 
 import androidx.annotation.NonNull;
 import androidx.annotation.Nullable;
@@ -64,6 +72,11 @@ public class MaxUnrealPlugin
     private static final String TAG     = "MaxUnrealPlugin";
     private static final String SDK_TAG = "AppLovinSdk";
 
+    // Compact waterfall encoding sent with ad errors, see getWaterfallData()
+    private static final int  WATERFALL_DATA_VERSION     = 1;
+    private static final char WATERFALL_FIELD_SEPARATOR  = '\u001F';
+    private static final char WATERFALL_RECORD_SEPARATOR = '\u001E';
+
     // Parent Fields
     private AppLovinSdk sdk;
     private boolean     isPluginInitialized = false;
@@ -88,10 +101,13 @@ public class MaxUnrealPlugin
     private final Map<String, MaxInterstitialAd> interstitials = new HashMap<>( 2 );
     private final Map<String, MaxRewardedAd>     rewardedAds   = new HashMap<>( 2 );
 
+    // Handles that Unreal gave the ad units, sent back with their events. Set on the Unreal thread and read on the SDK callback threads.
+    private final Map<String, Integer> adUnitHandles = new ConcurrentHashMap<>( 4 );
+
     // Banner Fields
     private final Map<String, MaxAdView>   adViews                    = new HashMap<>( 2 );
     private final Map<String, MaxAdFormat> adViewAdFormats            = new HashMap<>( 2 );
-    private final Map<String, String>      adViewPositions            = new HashMap<>( 2 );
+    private final Map<String, Integer>     adViewPositions            = new HashMap<>( 2 );
     private final Map<String, MaxAdFormat> verticalAdViewFormats      = new HashMap<>( 2 );
     private final List<String>             adUnitIdsToShowAfterCreate = new ArrayList<>( 2 );
 
@@ -108,6 +124,31 @@ public class MaxUnrealPlugin
         void onReceivedEvent(final String name, final String body);
     }
 
+    /**
+     * Optional listener that receives ad events encoded by {@link BinaryEventWriter} instead of JSON. SDK and CMP events are always sent as JSON.
+     */
+    public interface BinaryEventListener
+            extends EventListener
+    {
+        /**
+         * @param body   A direct buffer holding the encoded event. It is reused after this call returns, so it must be consumed synchronously.
+         * @param length The number of bytes written to {@code body}.
+         */
+        void onReceivedBinaryEvent(final String name, final ByteBuffer body, final int length);
+    }
+
+    /**
+     * Optional listener that is told when the system asks the app to trim memory, so that Unreal can release ads it can reload later.
+     */
+    public interface MemoryPressureListener
+    {
+        /**
+         * @param level The {@link ComponentCallbacks2} trim level, from {@link ComponentCallbacks2#TRIM_MEMORY_RUNNING_LOW} up.
+         *              {@link ComponentCallbacks2#TRIM_MEMORY_COMPLETE} is also sent for {@link ComponentCallbacks2#onLowMemory()}.
+         */
+        void onMemoryPressure(final int level);
+    }
+
     // region Initialization
     public MaxUnrealPlugin(final Activity activity)
     {
@@ -136,6 +177,11 @@ public class MaxUnrealPlugin
         // Set listener
         eventListener = listener;
 
+        if ( listener instanceof MemoryPressureListener )
+        {
+            context.registerComponentCallbacks( new MemoryPressureCallbacks( (MemoryPressureListener) listener ) );
+        }
+
         val initConfigBuilder = AppLovinSdkInitializationConfiguration.builder( sdkKey )
                 .setMediationProvider( AppLovinMediationProvider.MAX )
                 .setPluginVersion( "Unreal-" + pluginVersion );
@@ -466,10 +512,42 @@ public class MaxUnrealPlugin
         val deserialized = deserialize( parameters );
         sdk.getEventService().trackEvent( event, deserialized );
     }
+
+    // Events buffered by FAppLovinMAXEventBatch, as a JSON array of {"name": ..., "parameters": {...}} objects
+    public void trackEvents(final String serializedEvents)
+    {
+        if ( sdk == null ) return;
+
+        try
+        {
+            val events = new JSONArray( serializedEvents );
+            for ( int i = 0; i < events.length(); i++ )
+            {
+                val event = events.getJSONObject( i );
+                val parameters = event.optJSONObject( "parameters" );
+                sdk.getEventService().trackEvent( event.getString( "name" ), parameters != null ? JsonUtils.toStringMap( parameters ) : Collections.<String, String>emptyMap() );
+            }
+        }
+        catch ( Throwable th )
+        {
+            e( "Failed to deserialize events: (" + serializedEvents + ") with exception: " + th );
+        }
+    }
+    // endregion
+
+    // region Ad Units
+
+    /**
+     * Called by Unreal before the first ad of the ad unit is created, so that the ad unit's events carry its handle and Unreal does not need to look up the identifier.
+     */
+    public void setAdUnitHandle(final String adUnitId, final int handle)
+    {
+        adUnitHandles.put( adUnitId, handle );
+    }
     // endregion
 
     // region Banners
-    public void createBanner(final String adUnitId, final String bannerPosition)
+    public void createBanner(final String adUnitId, final int bannerPosition)
     {
         createAdView( adUnitId, getDeviceSpecificBannerAdViewAdFormat(), bannerPosition );
     }
@@ -489,7 +567,7 @@ public class MaxUnrealPlugin
         setAdViewExtraParameters( adUnitId, getDeviceSpecificBannerAdViewAdFormat(), key, value );
     }
 
-    public void updateBannerPosition(final String adUnitId, final String bannerPosition)
+    public void updateBannerPosition(final String adUnitId, final int bannerPosition)
     {
         updateAdViewPosition( adUnitId, bannerPosition, getDeviceSpecificBannerAdViewAdFormat() );
     }
@@ -511,7 +589,7 @@ public class MaxUnrealPlugin
     // endregion
 
     // region MRECS
-    public void createMRec(final String adUnitId, final String mrecPosition)
+    public void createMRec(final String adUnitId, final int mrecPosition)
     {
         createAdView( adUnitId, MaxAdFormat.MREC, mrecPosition );
     }
@@ -526,7 +604,7 @@ public class MaxUnrealPlugin
         setAdViewExtraParameters( adUnitId, MaxAdFormat.MREC, key, value );
     }
 
-    public void updateMRecPosition(final String adUnitId, final String mrecPosition)
+    public void updateMRecPosition(final String adUnitId, final int mrecPosition)
     {
         updateAdViewPosition( adUnitId, mrecPosition, MaxAdFormat.MREC );
     }
@@ -547,6 +625,37 @@ public class MaxUnrealPlugin
     }
     // endregion
 
+    // region Ad View Commands
+    /**
+     * Applies the ad view commands buffered by FAppLovinMAXAdViewCommandBuffer in a single UI thread pass.
+     * Each command holds the collapsed operations for one ad view, as a JSON object with the ad unit id, format and the changed state.
+     */
+    public void applyAdViewCommands(final String serializedCommands)
+    {
+        final JSONArray commands;
+        try
+        {
+            commands = new JSONArray( serializedCommands );
+        }
+        catch ( Throwable th )
+        {
+            e( "Failed to deserialize ad view commands: (" + serializedCommands + ") with exception: " + th );
+            return;
+        }
+
+        getGameActivity().runOnUiThread( () -> {
+            for ( int i = 0; i < commands.length(); i++ )
+            {
+                val command = commands.optJSONObject( i );
+                if ( command != null )
+                {
+                    applyAdViewCommandOnUiThread( command );
+                }
+            }
+        } );
+    }
+    // endregion
+
     // region Interstitials
     public void loadInterstitial(final String adUnitId)
     {
@@ -571,6 +680,15 @@ public class MaxUnrealPlugin
         val interstitial = retrieveInterstitial( adUnitId );
         interstitial.setExtraParameter( key, value );
     }
+
+    public void destroyInterstitial(final String adUnitId)
+    {
+        val interstitial = interstitials.remove( adUnitId );
+        if ( interstitial != null )
+        {
+            interstitial.destroy();
+        }
+    }
     // endregion
 
     // region Rewarded
@@ -597,6 +715,15 @@ public class MaxUnrealPlugin
         val rewardedAd = retrieveRewardedAd( adUnitId );
         rewardedAd.setExtraParameter( key, value );
     }
+
+    public void destroyRewardedAd(final String adUnitId)
+    {
+        val rewardedAd = rewardedAds.remove( adUnitId );
+        if ( rewardedAd != null )
+        {
+            rewardedAd.destroy();
+        }
+    }
     // endregion
 
     // region Ad Callbacks
@@ -610,7 +737,7 @@ public class MaxUnrealPlugin
             name = ( MaxAdFormat.MREC == adFormat ) ? "OnMRecAdLoadedEvent" : "OnBannerAdLoadedEvent";
 
             val adViewPosition = adViewPositions.get( ad.getAdUnitId() );
-            if ( !TextUtils.isEmpty( adViewPosition ) )
+            if ( adViewPosition != null )
             {
                 // Only position ad if not native UI component
                 positionAdView( ad );
@@ -638,7 +765,7 @@ public class MaxUnrealPlugin
             return;
         }
 
-        sendUnrealEvent( name, getAdInfo( ad ) );
+        sendUnrealAdEvent( name, ad.getAdUnitId(), ad, null, null );
     }
 
     @Override
@@ -669,10 +796,7 @@ public class MaxUnrealPlugin
             return;
         }
 
-        val params = getErrorInfo( error );
-        JsonUtils.putString( params, "adUnitIdentifier", adUnitId );
-
-        sendUnrealEvent( name, params );
+        sendUnrealAdEvent( name, adUnitId, null, error, null );
     }
 
     @Override
@@ -702,7 +826,7 @@ public class MaxUnrealPlugin
             return;
         }
 
-        sendUnrealEvent( name, getAdInfo( ad ) );
+        sendUnrealAdEvent( name, ad.getAdUnitId(), ad, null, null );
     }
 
     @Override
@@ -722,7 +846,7 @@ public class MaxUnrealPlugin
             name = "OnRewardedAdDisplayedEvent";
         }
 
-        sendUnrealEvent( name, getAdInfo( ad ) );
+        sendUnrealAdEvent( name, ad.getAdUnitId(), ad, null, null );
     }
 
     @Override
@@ -742,10 +866,7 @@ public class MaxUnrealPlugin
             name = "OnRewardedAdDisplayFailedEvent";
         }
 
-        val params = getAdInfo( ad );
-        JsonUtils.putAll( params, getErrorInfo( error ) );
-
-        sendUnrealEvent( name, params );
+        sendUnrealAdEvent( name, ad.getAdUnitId(), ad, error, null );
     }
 
     @Override
@@ -765,7 +886,7 @@ public class MaxUnrealPlugin
             name = "OnRewardedAdHiddenEvent";
         }
 
-        sendUnrealEvent( name, getAdInfo( ad ) );
+        sendUnrealAdEvent( name, ad.getAdUnitId(), ad, null, null );
     }
 
     @Override
@@ -778,7 +899,7 @@ public class MaxUnrealPlugin
             return;
         }
 
-        sendUnrealEvent( ( MaxAdFormat.MREC == adFormat ) ? "OnMRecAdExpandedEvent" : "OnBannerAdExpandedEvent", getAdInfo( ad ) );
+        sendUnrealAdEvent( ( MaxAdFormat.MREC == adFormat ) ? "OnMRecAdExpandedEvent" : "OnBannerAdExpandedEvent", ad.getAdUnitId(), ad, null, null );
     }
 
     @Override
@@ -791,7 +912,7 @@ public class MaxUnrealPlugin
             return;
         }
 
-        sendUnrealEvent( ( MaxAdFormat.MREC == adFormat ) ? "OnMRecAdCollapsedEvent" : "OnBannerAdCollapsedEvent", getAdInfo( ad ) );
+        sendUnrealAdEvent( ( MaxAdFormat.MREC == adFormat ) ? "OnMRecAdCollapsedEvent" : "OnBannerAdCollapsedEvent", ad.getAdUnitId(), ad, null, null );
     }
 
     @Override
@@ -804,11 +925,7 @@ public class MaxUnrealPlugin
             return;
         }
 
-        val params = getAdInfo( ad );
-        JsonUtils.putString( params, "label", reward.getLabel() );
-        JsonUtils.putInt( params, "amount", reward.getAmount() );
-
-        sendUnrealEvent( "OnRewardedAdReceivedRewardEvent", params );
+        sendUnrealAdEvent( "OnRewardedAdReceivedRewardEvent", ad.getAdUnitId(), ad, null, reward );
     }
 
     @Override
@@ -838,16 +955,16 @@ public class MaxUnrealPlugin
             return;
         }
 
-        sendUnrealEvent( name, getAdInfo( ad ) );
+        sendUnrealAdEvent( name, ad.getAdUnitId(), ad, null, null );
     }
 
     // region Internal Methods
-    private void createAdView(final String adUnitId, final MaxAdFormat adFormat, final String adViewPosition)
+    private void createAdView(final String adUnitId, final MaxAdFormat adFormat, final int adViewPosition)
     {
         // Run on main thread to ensure there are no concurrency issues with other ad view methods
         getGameActivity().runOnUiThread( () -> {
 
-            d( "Creating " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\" and position: \"" + adViewPosition + "\"" );
+            d( "Creating " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\" and position: \"" + getAdViewPositionName( adViewPosition ) + "\"" );
 
             // Retrieve ad view from the map
             val adView = retrieveAdView( adUnitId, adFormat, adViewPosition );
@@ -885,82 +1002,90 @@ public class MaxUnrealPlugin
 
     private void setAdViewPlacement(final String adUnitId, final MaxAdFormat adFormat, final String placement)
     {
-        getGameActivity().runOnUiThread( () -> {
+        getGameActivity().runOnUiThread( () -> setAdViewPlacementOnUiThread( adUnitId, adFormat, placement ) );
+    }
 
-            d( "Setting placement \"" + placement + "\" for " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\"" );
+    private void setAdViewPlacementOnUiThread(final String adUnitId, final MaxAdFormat adFormat, final String placement)
+    {
+        d( "Setting placement \"" + placement + "\" for " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\"" );
 
-            val adView = retrieveAdView( adUnitId, adFormat );
-            if ( adView == null )
-            {
-                e( adFormat.getLabel() + " does not exist" );
-                return;
-            }
+        val adView = retrieveAdView( adUnitId, adFormat );
+        if ( adView == null )
+        {
+            e( adFormat.getLabel() + " does not exist" );
+            return;
+        }
 
-            adView.setPlacement( placement );
-        } );
+        adView.setPlacement( placement );
     }
 
-    private void updateAdViewPosition(final String adUnitId, final String adViewPosition, final MaxAdFormat adFormat)
+    private void updateAdViewPosition(final String adUnitId, final int adViewPosition, final MaxAdFormat adFormat)
     {
-        getGameActivity().runOnUiThread( () -> {
+        getGameActivity().runOnUiThread( () -> updateAdViewPositionOnUiThread( adUnitId, adViewPosition, adFormat ) );
+    }
 
-            d( "Updating " + adFormat.getLabel() + " position to \"" + adViewPosition + "\" for ad unit id \"" + adUnitId + "\"" );
+    private void updateAdViewPositionOnUiThread(final String adUnitId, final int adViewPosition, final MaxAdFormat adFormat)
+    {
+        d( "Updating " + adFormat.getLabel() + " position to \"" + getAdViewPositionName( adViewPosition ) + "\" for ad unit id \"" + adUnitId + "\"" );
 
-            // Retrieve ad view from the map
-            val adView = retrieveAdView( adUnitId, adFormat );
-            if ( adView == null )
-            {
-                e( adFormat.getLabel() + " does not exist" );
-                return;
-            }
+        // Retrieve ad view from the map
+        val adView = retrieveAdView( adUnitId, adFormat );
+        if ( adView == null )
+        {
+            e( adFormat.getLabel() + " does not exist" );
+            return;
+        }
 
-            // Check if the previous position is same as the new position. If so, no need to update the position again.
-            val previousPosition = adViewPositions.get( adUnitId );
-            if ( adViewPosition == null || adViewPosition.equals( previousPosition ) ) return;
+        // Check if the previous position is same as the new position. If so, no need to update the position again.
+        val previousPosition = adViewPositions.get( adUnitId );
+        if ( previousPosition != null && previousPosition == adViewPosition ) return;
 
-            adViewPositions.put( adUnitId, adViewPosition );
-            positionAdView( adUnitId, adFormat );
-        } );
+        adViewPositions.put( adUnitId, adViewPosition );
+        positionAdView( adUnitId, adFormat );
     }
 
     private void showAdView(final String adUnitId, final MaxAdFormat adFormat)
     {
-        getGameActivity().runOnUiThread( () -> {
+        getGameActivity().runOnUiThread( () -> showAdViewOnUiThread( adUnitId, adFormat ) );
+    }
 
-            d( "Showing " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\"" );
+    private void showAdViewOnUiThread(final String adUnitId, final MaxAdFormat adFormat)
+    {
+        d( "Showing " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\"" );
 
-            val adView = retrieveAdView( adUnitId, adFormat );
-            if ( adView == null )
-            {
-                e( adFormat.getLabel() + " does not exist for ad unit id " + adUnitId );
+        val adView = retrieveAdView( adUnitId, adFormat );
+        if ( adView == null )
+        {
+            e( adFormat.getLabel() + " does not exist for ad unit id " + adUnitId );
 
-                // The adView has not yet been created. Store the ad unit ID, so that it can be displayed once the banner has been created.
-                adUnitIdsToShowAfterCreate.add( adUnitId );
-                return;
-            }
+            // The adView has not yet been created. Store the ad unit ID, so that it can be displayed once the banner has been created.
+            adUnitIdsToShowAfterCreate.add( adUnitId );
+            return;
+        }
 
-            adView.setVisibility( View.VISIBLE );
-            adView.startAutoRefresh();
-        } );
+        adView.setVisibility( View.VISIBLE );
+        adView.startAutoRefresh();
     }
 
     private void hideAdView(final String adUnitId, final MaxAdFormat adFormat)
     {
-        getGameActivity().runOnUiThread( () -> {
+        getGameActivity().runOnUiThread( () -> hideAdViewOnUiThread( adUnitId, adFormat ) );
+    }
 
-            d( "Hiding " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\"" );
-            adUnitIdsToShowAfterCreate.remove( adUnitId );
+    private void hideAdViewOnUiThread(final String adUnitId, final MaxAdFormat adFormat)
+    {
+        d( "Hiding " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\"" );
+        adUnitIdsToShowAfterCreate.remove( adUnitId );
 
-            val adView = retrieveAdView( adUnitId, adFormat );
-            if ( adView == null )
-            {
-                e( adFormat.getLabel() + " does not exist" );
-                return;
-            }
+        val adView = retrieveAdView( adUnitId, adFormat );
+        if ( adView == null )
+        {
+            e( adFormat.getLabel() + " does not exist" );
+            return;
+        }
 
-            adView.setVisibility( View.GONE );
-            adView.stopAutoRefresh();
-        } );
+        adView.setVisibility( View.GONE );
+        adView.stopAutoRefresh();
     }
 
     private void destroyAdView(final String adUnitId, final MaxAdFormat adFormat)
@@ -995,56 +1120,105 @@ public class MaxUnrealPlugin
 
     private void setAdViewBackgroundColor(final String adUnitId, final MaxAdFormat adFormat, final String hexColorCode)
     {
-        getGameActivity().runOnUiThread( () -> {
+        getGameActivity().runOnUiThread( () -> setAdViewBackgroundColorOnUiThread( adUnitId, adFormat, hexColorCode ) );
+    }
 
-            d( "Setting " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\" to color: " + hexColorCode );
+    private void setAdViewBackgroundColorOnUiThread(final String adUnitId, final MaxAdFormat adFormat, final String hexColorCode)
+    {
+        d( "Setting " + adFormat.getLabel() + " with ad unit id \"" + adUnitId + "\" to color: " + hexColorCode );
 
-            val adView = retrieveAdView( adUnitId, adFormat );
-            if ( adView == null )
-            {
-                e( adFormat.getLabel() + " does not exist" );
-                return;
-            }
+        val adView = retrieveAdView( adUnitId, adFormat );
+        if ( adView == null )
+        {
+            e( adFormat.getLabel() + " does not exist" );
+            return;
+        }
 
-            adView.setBackgroundColor( Color.parseColor( hexColorCode ) );
-        } );
+        adView.setBackgroundColor( Color.parseColor( hexColorCode ) );
     }
 
     private void setAdViewExtraParameters(final String adUnitId, final MaxAdFormat adFormat, final String key, final String value)
     {
-        getGameActivity().runOnUiThread( () -> {
+        getGameActivity().runOnUiThread( () -> setAdViewExtraParametersOnUiThread( adUnitId, adFormat, key, value ) );
+    }
 
-            d( "Setting " + adFormat.getLabel() + " extra with key: \"" + key + "\" value: " + value );
+    private void setAdViewExtraParametersOnUiThread(final String adUnitId, final MaxAdFormat adFormat, final String key, final String value)
+    {
+        d( "Setting " + adFormat.getLabel() + " extra with key: \"" + key + "\" value: " + value );
 
-            // Retrieve ad view from the map
-            val adView = retrieveAdView( adUnitId, adFormat );
-            if ( adView == null )
+        // Retrieve ad view from the map
+        val adView = retrieveAdView( adUnitId, adFormat );
+        if ( adView == null )
+        {
+            e( adFormat.getLabel() + " does not exist" );
+            return;
+        }
+
+        adView.setExtraParameter( key, value );
+
+        // Handle local changes as needed
+        if ( "force_banner".equalsIgnoreCase( key ) && MaxAdFormat.MREC != adFormat )
+        {
+            final MaxAdFormat forcedAdFormat;
+
+            boolean shouldForceBanner = Boolean.parseBoolean( value );
+            if ( shouldForceBanner )
             {
-                e( adFormat.getLabel() + " does not exist" );
-                return;
+                forcedAdFormat = MaxAdFormat.BANNER;
             }
+            else
+            {
+                forcedAdFormat = getDeviceSpecificBannerAdViewAdFormat();
+            }
+
+            adViewAdFormats.put( adUnitId, forcedAdFormat );
+            positionAdView( adUnitId, forcedAdFormat );
+        }
+    }
+
+    private void applyAdViewCommandOnUiThread(final JSONObject command)
+    {
+        val adUnitId = command.optString( "adUnitId" );
+        val adFormat = command.optBoolean( "isMRec" ) ? MaxAdFormat.MREC : getDeviceSpecificBannerAdViewAdFormat();
 
-            adView.setExtraParameter( key, value );
+        if ( command.has( "placement" ) )
+        {
+            setAdViewPlacementOnUiThread( adUnitId, adFormat, command.optString( "placement" ) );
+        }
 
-            // Handle local changes as needed
-            if ( "force_banner".equalsIgnoreCase( key ) && MaxAdFormat.MREC != adFormat )
+        val extraParameters = command.optJSONObject( "extraParameters" );
+        if ( extraParameters != null )
+        {
+            val keys = extraParameters.keys();
+            while ( keys.hasNext() )
             {
-                final MaxAdFormat forcedAdFormat;
+                val key = keys.next();
+                setAdViewExtraParametersOnUiThread( adUnitId, adFormat, key, extraParameters.optString( key ) );
+            }
+        }
 
-                boolean shouldForceBanner = Boolean.parseBoolean( value );
-                if ( shouldForceBanner )
-                {
-                    forcedAdFormat = MaxAdFormat.BANNER;
-                }
-                else
-                {
-                    forcedAdFormat = getDeviceSpecificBannerAdViewAdFormat();
-                }
+        if ( command.has( "backgroundColor" ) )
+        {
+            setAdViewBackgroundColorOnUiThread( adUnitId, adFormat, command.optString( "backgroundColor" ) );
+        }
 
-                adViewAdFormats.put( adUnitId, forcedAdFormat );
-                positionAdView( adUnitId, forcedAdFormat );
+        // Position and visibility go last so that the ad view is laid out once with its final state
+        if ( command.has( "position" ) )
+        {
+            updateAdViewPositionOnUiThread( adUnitId, command.optInt( "position" ), adFormat );
+        }
+
+        if ( command.has( "visible" ) )
+        {
+            if ( command.optBoolean( "visible" ) )
+            {
+                showAdViewOnUiThread( adUnitId, adFormat );
             }
-        } );
+            else
+            {
+                hideAdViewOnUiThread( adUnitId, adFormat );
+            }
+        }
     }
 
     private void logInvalidAdFormat(MaxAdFormat adFormat)
@@ -1102,7 +1276,7 @@ public class MaxUnrealPlugin
         return retrieveAdView( adUnitId, adFormat, null );
     }
 
-    public MaxAdView retrieveAdView(String adUnitId, MaxAdFormat adFormat, String adViewPosition)
+    public MaxAdView retrieveAdView(String adUnitId, MaxAdFormat adFormat, Integer adViewPosition)
     {
         var result = adViews.get( adUnitId );
         if ( result == null && adViewPosition != null )
@@ -1150,113 +1324,81 @@ public class MaxUnrealPlugin
         params.height = height;
         adView.setLayoutParams( params );
 
-        // Parse gravity
-        var gravity = 0;
-
         // Reset rotation, translation and margins so that the banner can be positioned again
         adView.setRotation( 0 );
         adView.setTranslationX( 0 );
         params.setMargins( 0, 0, 0, 0 );
         verticalAdViewFormats.remove( adUnitId );
 
-        if ( "centered".equalsIgnoreCase( adViewPosition ) )
+        if ( adViewPosition == null || adViewPosition < 0 || adViewPosition >= AD_VIEW_LAYOUTS.length )
         {
-            gravity = Gravity.CENTER_VERTICAL | Gravity.CENTER_HORIZONTAL;
+            e( "Error positioning ad view due to invalid position: " + adViewPosition );
+            return;
         }
-        else
-        {
-            // Figure out vertical params
-            if ( adViewPosition == null )
-            {
-                e( "Error positioning ad view due to null position" );
-                return;
-            }
-            else if ( adViewPosition.contains( "top" ) )
-            {
-                gravity = Gravity.TOP;
-            }
-            else if ( adViewPosition.contains( "bottom" ) )
-            {
-                gravity = Gravity.BOTTOM;
-            }
 
-            // Figure out horizontal params
-            if ( adViewPosition.contains( "center" ) )
-            {
-                gravity |= Gravity.CENTER_HORIZONTAL;
-                params.width = ( MaxAdFormat.MREC == adFormat ) ? width : RelativeLayout.LayoutParams.MATCH_PARENT; // Stretch width if banner
+        val layout = AD_VIEW_LAYOUTS[adViewPosition];
+        var gravity = layout.gravity;
 
-                // Check if the publisher wants the ad view to be vertical and update the position accordingly ('CenterLeft' or 'CenterRight').
-                val containsLeft = adViewPosition.contains( "left" );
-                val containsRight = adViewPosition.contains( "right" );
-                if ( containsLeft || containsRight )
-                {
-                    // First, center the ad view in the view.
-                    gravity |= Gravity.CENTER_VERTICAL;
+        if ( layout.width == AdViewLayout.WIDTH_AD )
+        {
+            params.width = width;
+        }
+        else if ( layout.width == AdViewLayout.WIDTH_STRETCH_BANNER )
+        {
+            params.width = ( MaxAdFormat.MREC == adFormat ) ? width : RelativeLayout.LayoutParams.MATCH_PARENT; // Stretch width if banner
+        }
 
-                    // For banners, set the width to the height of the screen to span the ad across the screen after it is rotated.
-                    // Android by default clips a view bounds if it goes over the size of the screen. We can overcome it by setting negative margins to match our required size.
-                    if ( MaxAdFormat.MREC == adFormat )
-                    {
-                        gravity |= adViewPosition.contains( "left" ) ? Gravity.LEFT : Gravity.RIGHT;
-                    }
-                    else
-                    {
-                        /* Align the center of the view such that when rotated it snaps into place.
-                         *
-                         *                  +---+---+-------+
-                         *                  |   |           |
-                         *                  |   |           |
-                         *                  |   |           |
-                         *                  |   |           |
-                         *                  |   |           |
-                         *                  |   |           |
-                         *    +-------------+---+-----------+--+
-                         *    |             | + |   +       |  |
-                         *    +-------------+---+-----------+--+
-                         *                  |   |           |
-                         *                  | ^ |   ^       |
-                         *                  | +-----+       |
-                         *                  Translation     |
-                         *                  |   |           |
-                         *                  |   |           |
-                         *                  +---+-----------+
-                         */
-                        val windowRect = new Rect();
-                        relativeLayout.getWindowVisibleDisplayFrame( windowRect );
-
-                        val windowWidth = windowRect.width();
-                        val windowHeight = windowRect.height();
-                        val longSide = Math.max( windowWidth, windowHeight );
-                        val shortSide = Math.min( windowWidth, windowHeight );
-                        val margin = ( longSide - shortSide ) / 2;
-                        params.setMargins( -margin, 0, -margin, 0 );
-
-                        // The view is now at the center of the screen and so is it's pivot point. Move its center such that when rotated, it snaps into the vertical position we need.
-                        val translationRaw = ( windowWidth / 2 ) - ( height / 2 );
-                        val translationX = containsLeft ? -translationRaw : translationRaw;
-                        adView.setTranslationX( translationX );
-
-                        // We have the view's center in the correct position. Now rotate it to snap into place.
-                        adView.setRotation( 270 );
-
-                        // Store the ad view with format, so that it can be updated when the orientation changes.
-                        verticalAdViewFormats.put( adUnitId, adFormat );
-                    }
-                }
+        // Check if the publisher wants the ad view to be vertical ('CenterLeft' or 'CenterRight')
+        if ( layout.verticalEdge != 0 )
+        {
+            // For banners, set the width to the height of the screen to span the ad across the screen after it is rotated.
+            // Android by default clips a view bounds if it goes over the size of the screen. We can overcome it by setting negative margins to match our required size.
+            if ( MaxAdFormat.MREC == adFormat )
+            {
+                gravity |= layout.verticalEdge;
             }
             else
             {
-                params.width = width;
-
-                if ( adViewPosition.contains( "left" ) )
-                {
-                    gravity |= Gravity.LEFT;
-                }
-                else if ( adViewPosition.contains( "right" ) )
-                {
-                    gravity |= Gravity.RIGHT;
-                }
+                /* Align the center of the view such that when rotated it snaps into place.
+                 *
+                 *                  +---+---+-------+
+                 *                  |   |           |
+                 *                  |   |           |
+                 *                  |   |           |
+                 *                  |   |           |
+                 *                  |   |           |
+                 *                  |   |           |
+                 *    +-------------+---+-----------+--+
+                 *    |             | + |   +       |  |
+                 *    +-------------+---+-----------+--+
+                 *                  |   |           |
+                 *                  | ^ |   ^       |
+                 *                  | +-----+       |
+                 *                  Translation     |
+                 *                  |   |           |
+                 *                  |   |           |
+                 *                  +---+-----------+
+                 */
+                val windowRect = new Rect();
+                relativeLayout.getWindowVisibleDisplayFrame( windowRect );
+
+                val windowWidth = windowRect.width();
+                val windowHeight = windowRect.height();
+                val longSide = Math.max( windowWidth, windowHeight );
+                val shortSide = Math.min( windowWidth, windowHeight );
+                val margin = ( longSide - shortSide ) / 2;
+                params.setMargins( -margin, 0, -margin, 0 );
+
+                // The view is now at the center of the screen and so is it's pivot point. Move its center such that when rotated, it snaps into the vertical position we need.
+                val translationRaw = ( windowWidth / 2 ) - ( height / 2 );
+                val translationX = ( layout.verticalEdge == Gravity.LEFT ) ? -translationRaw : translationRaw;
+                adView.setTranslationX( translationX );
+
+                // We have the view's center in the correct position. Now rotate it to snap into place.
+                adView.setRotation( 270 );
+
+                // Store the ad view with format, so that it can be updated when the orientation changes.
+                verticalAdViewFormats.put( adUnitId, adFormat );
             }
         }
 
@@ -1287,6 +1429,52 @@ public class MaxUnrealPlugin
         }
     }
 
+    /**
+     * How an ad view is laid out for one of the positions sent by the Unreal plugin as {@code EAdViewPosition} values.
+     */
+    protected static class AdViewLayout
+    {
+        // Keep the current width
+        public static final int WIDTH_UNCHANGED      = 0;
+        // Use the width of the ad format
+        public static final int WIDTH_AD             = 1;
+        // Span the screen for banners, use the width of the ad format for MRECs
+        public static final int WIDTH_STRETCH_BANNER = 2;
+
+        public final String name;
+        public final int    gravity;
+        public final int    width;
+
+        // Gravity.LEFT or Gravity.RIGHT for positions where banners are rotated to run along the edge, otherwise 0
+        public final int verticalEdge;
+
+        private AdViewLayout(final String name, final int gravity, final int width, final int verticalEdge)
+        {
+            this.name = name;
+            this.gravity = gravity;
+            this.width = width;
+            this.verticalEdge = verticalEdge;
+        }
+    }
+
+    // Indexed by EAdViewPosition, so the order must match the enum in AppLovinMAX.h
+    private static final AdViewLayout[] AD_VIEW_LAYOUTS = {
+            new AdViewLayout( "top_left", Gravity.TOP | Gravity.LEFT, AdViewLayout.WIDTH_AD, 0 ),
+            new AdViewLayout( "top_center", Gravity.TOP | Gravity.CENTER_HORIZONTAL, AdViewLayout.WIDTH_STRETCH_BANNER, 0 ),
+            new AdViewLayout( "top_right", Gravity.TOP | Gravity.RIGHT, AdViewLayout.WIDTH_AD, 0 ),
+            new AdViewLayout( "centered", Gravity.CENTER_VERTICAL | Gravity.CENTER_HORIZONTAL, AdViewLayout.WIDTH_UNCHANGED, 0 ),
+            new AdViewLayout( "center_left", Gravity.CENTER_VERTICAL | Gravity.CENTER_HORIZONTAL, AdViewLayout.WIDTH_STRETCH_BANNER, Gravity.LEFT ),
+            new AdViewLayout( "center_right", Gravity.CENTER_VERTICAL | Gravity.CENTER_HORIZONTAL, AdViewLayout.WIDTH_STRETCH_BANNER, Gravity.RIGHT ),
+            new AdViewLayout( "bottom_left", Gravity.BOTTOM | Gravity.LEFT, AdViewLayout.WIDTH_AD, 0 ),
+            new AdViewLayout( "bottom_center", Gravity.BOTTOM | Gravity.CENTER_HORIZONTAL, AdViewLayout.WIDTH_STRETCH_BANNER, 0 ),
+            new AdViewLayout( "bottom_right", Gravity.BOTTOM | Gravity.RIGHT, AdViewLayout.WIDTH_AD, 0 )
+    };
+
+    private static String getAdViewPositionName(final int adViewPosition)
+    {
+        return ( adViewPosition >= 0 && adViewPosition < AD_VIEW_LAYOUTS.length ) ? AD_VIEW_LAYOUTS[adViewPosition].name : String.valueOf( adViewPosition );
+    }
+
     public static AdViewSize getAdViewSize(final MaxAdFormat format)
     {
         if ( MaxAdFormat.LEADER == format )
@@ -1326,11 +1514,64 @@ public class MaxUnrealPlugin
 
         JsonUtils.putInt( errorInfo, "code", error.getCode() );
         JsonUtils.putString( errorInfo, "message", error.getMessage() );
-        JsonUtils.putString( errorInfo, "waterfall", error.getWaterfall() != null ? error.getWaterfall().toString() : "" );
+        JsonUtils.putString( errorInfo, "waterfallData", getWaterfallData( error ) );
 
         return errorInfo;
     }
 
+    /**
+     * Encodes the waterfall compactly for FAdError, which only parses it if the waterfall is read: a version, the waterfall name, test name and latency,
+     * then one record per network response. Fields are separated by \u001F and records by \u001E.
+     * <p>
+     * NOTE: Must match ParseWaterfall in AdError.cpp in the Unreal plugin.
+     */
+    private static String getWaterfallData(final MaxError error)
+    {
+        val waterfall = error.getWaterfall();
+        if ( waterfall == null ) return "";
+
+        val builder = new StringBuilder( 256 );
+        builder.append( WATERFALL_DATA_VERSION )
+                .append( WATERFALL_FIELD_SEPARATOR ).append( sanitizeWaterfallField( waterfall.getName() ) )
+                .append( WATERFALL_FIELD_SEPARATOR ).append( sanitizeWaterfallField( waterfall.getTestName() ) )
+                .append( WATERFALL_FIELD_SEPARATOR ).append( waterfall.getLatencyMillis() );
+
+        for ( val response : waterfall.getNetworkResponses() )
+        {
+            val mediatedNetwork = response.getMediatedNetwork();
+            val responseError = response.getError();
+
+            builder.append( WATERFALL_RECORD_SEPARATOR ).append( getAdLoadStateCode( response.getAdLoadState() ) )
+                    .append( WATERFALL_FIELD_SEPARATOR ).append( response.isBidding() ? 1 : 0 )
+                    .append( WATERFALL_FIELD_SEPARATOR ).append( response.getLatencyMillis() )
+                    .append( WATERFALL_FIELD_SEPARATOR ).append( responseError != null ? responseError.getCode() : 0 )
+                    .append( WATERFALL_FIELD_SEPARATOR ).append( sanitizeWaterfallField( mediatedNetwork != null ? mediatedNetwork.getName() : null ) )
+                    .append( WATERFALL_FIELD_SEPARATOR ).append( sanitizeWaterfallField( responseError != null ? responseError.getMessage() : null ) );
+        }
+
+        return builder.toString();
+    }
+
+    // NOTE: Values must match EAdLoadState in the Unreal plugin
+    private static int getAdLoadStateCode(final MaxNetworkResponseInfo.AdLoadState adLoadState)
+    {
+        if ( adLoadState == MaxNetworkResponseInfo.AdLoadState.AD_LOADED )
+        {
+            return 1;
+        }
+        else if ( adLoadState == MaxNetworkResponseInfo.AdLoadState.FAILED_TO_LOAD )
+        {
+            return 2;
+        }
+
+        return 0;
+    }
+
+    private static String sanitizeWaterfallField(@Nullable final String value)
+    {
+        return StringUtils.emptyIfNull( value ).replace( WATERFALL_FIELD_SEPARATOR, ' ' ).replace( WATERFALL_RECORD_SEPARATOR, ' ' );
+    }
+
     private static Map<String, String> deserialize(final String serialized)
     {
         if ( !TextUtils.isEmpty( serialized ) )
@@ -1356,5 +1597,199 @@ public class MaxUnrealPlugin
     {
         eventListener.onReceivedEvent( name, params.toString() );
     }
+
+    private void sendUnrealAdEvent(final String name, final String adUnitId, @Nullable final MaxAd ad, @Nullable final MaxError error, @Nullable final MaxReward reward)
+    {
+        // Seconds on the monotonic clock, so that Unreal can measure how long the event takes to reach the game thread
+        val timestamp = System.nanoTime() / 1e9;
+
+        if ( eventListener instanceof BinaryEventListener )
+        {
+            val writer = binaryEventWriter.get().begin();
+            writer.putDouble( BinaryEventWriter.FIELD_TIMESTAMP, timestamp );
+            writer.putString( BinaryEventWriter.FIELD_AD_UNIT_IDENTIFIER, adUnitId );
+
+            val adUnitHandle = adUnitHandles.get( adUnitId );
+            if ( adUnitHandle != null )
+            {
+                writer.putInt( BinaryEventWriter.FIELD_AD_UNIT_HANDLE, adUnitHandle );
+            }
+
+            if ( ad != null )
+            {
+                writer.putString( BinaryEventWriter.FIELD_NETWORK_NAME, ad.getNetworkName() );
+                writer.putString( BinaryEventWriter.FIELD_CREATIVE_IDENTIFIER, ad.getCreativeId() );
+                writer.putString( BinaryEventWriter.FIELD_PLACEMENT, ad.getPlacement() );
+                writer.putDouble( BinaryEventWriter.FIELD_REVENUE, ad.getRevenue() );
+            }
+
+            if ( error != null )
+            {
+                writer.putInt( BinaryEventWriter.FIELD_ERROR_CODE, error.getCode() );
+                writer.putString( BinaryEventWriter.FIELD_ERROR_MESSAGE, error.getMessage() );
+                writer.putString( BinaryEventWriter.FIELD_ERROR_WATERFALL_DATA, getWaterfallData( error ) );
+            }
+
+            if ( reward != null )
+            {
+                writer.putString( BinaryEventWriter.FIELD_REWARD_LABEL, reward.getLabel() );
+                writer.putInt( BinaryEventWriter.FIELD_REWARD_AMOUNT, reward.getAmount() );
+            }
+
+            val buffer = writer.end();
+            ( (BinaryEventListener) eventListener ).onReceivedBinaryEvent( name, buffer, buffer.position() );
+            return;
+        }
+
+        val params = ( ad != null ) ? getAdInfo( ad ) : new JSONObject();
+        if ( ad == null )
+        {
+            JsonUtils.putString( params, "adUnitIdentifier", adUnitId );
+        }
+
+        if ( error != null )
+        {
+            JsonUtils.putAll( params, getErrorInfo( error ) );
+        }
+
+        if ( reward != null )
+        {
+            JsonUtils.putString( params, "label", reward.getLabel() );
+            JsonUtils.putInt( params, "amount", reward.getAmount() );
+        }
+
+        JsonUtils.putDouble( params, "timestamp", timestamp );
+
+        val adUnitHandle = adUnitHandles.get( adUnitId );
+        if ( adUnitHandle != null )
+        {
+            JsonUtils.putInt( params, "adUnitHandle", adUnitHandle );
+        }
+
+        sendUnrealEvent( name, params );
+    }
+
+    /**
+     * Forwards the trim levels that mean the app itself is under memory pressure. Lower levels only concern other processes.
+     */
+    private static class MemoryPressureCallbacks
+            implements ComponentCallbacks2
+    {
+        private final MemoryPressureListener listener;
+
+        MemoryPressureCallbacks(final MemoryPressureListener listener)
+        {
+            this.listener = listener;
+        }
+
+        @Override
+        public void onTrimMemory(final int level)
+        {
+            if ( level >= TRIM_MEMORY_RUNNING_LOW )
+            {
+                listener.onMemoryPressure( level );
+            }
+        }
+
+        @Override
+        public void onLowMemory()
+        {
+            listener.onMemoryPressure( TRIM_MEMORY_COMPLETE );
+        }
+
+        @Override
+        public void onConfigurationChanged(@NonNull final Configuration newConfig) { }
+    }
+
+    private static final ThreadLocal<BinaryEventWriter> binaryEventWriter = new ThreadLocal<BinaryEventWriter>()
+    {
+        @Override
+        protected BinaryEventWriter initialValue()
+        {
+            return new BinaryEventWriter();
+        }
+    };
+
+    /**
+     * Encodes ad events for {@link BinaryEventListener}: a version byte followed by (tag, value) fields and a zero end tag.
+     * Each tag is {@code (field << 2) | type}. Strings are an int32 byte count followed by UTF-8 bytes, and numbers are little-endian.
+     * <p>
+     * NOTE: The version, fields and types must match AppLovinMAXEventDecoder::DecodeBinaryAdEvent in the Unreal plugin.
+     */
+    private static class BinaryEventWriter
+    {
+        private static final int VERSION = 1;
+
+        private static final int TYPE_STRING = 0;
+        private static final int TYPE_DOUBLE = 1;
+        private static final int TYPE_INT    = 2;
+
+        private static final int FIELD_END                  = 0;
+        private static final int FIELD_AD_UNIT_IDENTIFIER   = 1;
+        private static final int FIELD_NETWORK_NAME         = 2;
+        private static final int FIELD_CREATIVE_IDENTIFIER  = 3;
+        private static final int FIELD_PLACEMENT            = 4;
+        private static final int FIELD_REVENUE              = 5;
+        private static final int FIELD_ERROR_CODE           = 6;
+        private static final int FIELD_ERROR_MESSAGE        = 7;
+        private static final int FIELD_ERROR_WATERFALL      = 8; // Replaced by FIELD_ERROR_WATERFALL_DATA
+        private static final int FIELD_REWARD_LABEL         = 9;
+        private static final int FIELD_REWARD_AMOUNT        = 10;
+        private static final int FIELD_TIMESTAMP            = 11;
+        private static final int FIELD_ERROR_WATERFALL_DATA = 12;
+        private static final int FIELD_AD_UNIT_HANDLE       = 13;
+
+        private ByteBuffer buffer = ByteBuffer.allocateDirect( 512 ).order( ByteOrder.LITTLE_ENDIAN );
+
+        BinaryEventWriter begin()
+        {
+            buffer.clear();
+            buffer.put( (byte) VERSION );
+            return this;
+        }
+
+        void putString(final int field, @Nullable final String value)
+        {
+            val bytes = StringUtils.emptyIfNull( value ).getBytes( StandardCharsets.UTF_8 );
+            ensureRemaining( 1 + 4 + bytes.length );
+            buffer.put( (byte) ( ( field << 2 ) | TYPE_STRING ) );
+            buffer.putInt( bytes.length );
+            buffer.put( bytes );
+        }
+
+        void putDouble(final int field, final double value)
+        {
+            ensureRemaining( 1 + 8 );
+            buffer.put( (byte) ( ( field << 2 ) | TYPE_DOUBLE ) );
+            buffer.putDouble( value );
+        }
+
+        void putInt(final int field, final int value)
+        {
+            ensureRemaining( 1 + 4 );
+            buffer.put( (byte) ( ( field << 2 ) | TYPE_INT ) );
+            buffer.putInt( value );
+        }
+
+        /**
+         * @return The encoded event, with its length given by {@link ByteBuffer#position()}.
+         */
+        ByteBuffer end()
+        {
+            ensureRemaining( 1 );
+            buffer.put( (byte) FIELD_END );
+            return buffer;
+        }
+
+        private void ensureRemaining(final int byteCount)
+        {
+            if ( buffer.remaining() >= byteCount ) return;
+
+            val grown = ByteBuffer.allocateDirect( Math.max( buffer.capacity() * 2, buffer.position() + byteCount ) ).order( ByteOrder.LITTLE_ENDIAN );
+            buffer.flip();
+            grown.put( buffer );
+            buffer = grown;
+        }
+    }
     // endregion
 }
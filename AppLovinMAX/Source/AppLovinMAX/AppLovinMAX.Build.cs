@@ -24,7 +24,9 @@ public class AppLovinMAX : ModuleRules
             {
                 "CoreUObject",
                 "Engine",
-                "Projects"
+                "Projects",
+                "RenderCore",
+                "RHI"
             }
         );
         
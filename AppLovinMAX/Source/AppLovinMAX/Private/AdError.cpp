@@ -0,0 +1,72 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AdError.h"
+
+namespace
+{
+    // NOTE: Must match getWaterfallData in MaxUnrealPlugin.java
+    const TCHAR *const WaterfallVersionPrefix = TEXT("1\x1F");
+    const TCHAR *const WaterfallRecordSeparator = TEXT("\x1E");
+    const TCHAR *const WaterfallFieldSeparator = TEXT("\x1F");
+
+    constexpr int32 WaterfallHeaderFieldCount = 4;
+    constexpr int32 NetworkResponseFieldCount = 6;
+
+    FAdWaterfallInfo ParseWaterfall(const FString &Payload)
+    {
+        FAdWaterfallInfo Waterfall;
+        if (!Payload.StartsWith(WaterfallVersionPrefix, ESearchCase::CaseSensitive)) return Waterfall;
+
+        TArray<FString> Records;
+        Payload.ParseIntoArray(Records, WaterfallRecordSeparator, false);
+
+        TArray<FString> Fields;
+        for (int32 RecordIndex = 0; RecordIndex < Records.Num(); RecordIndex++)
+        {
+            Records[RecordIndex].ParseIntoArray(Fields, WaterfallFieldSeparator, false);
+            if (RecordIndex == 0)
+            {
+                // Version, name, test name and latency
+                if (Fields.Num() < WaterfallHeaderFieldCount) return Waterfall;
+
+                Waterfall.Name = MoveTemp(Fields[1]);
+                Waterfall.TestName = MoveTemp(Fields[2]);
+                Waterfall.LatencyMillis = FCString::Atoi64(*Fields[3]);
+                continue;
+            }
+
+            // Load state, bidding, latency, error code, network name and error message
+            if (Fields.Num() < NetworkResponseFieldCount) continue;
+
+            FAdNetworkResponseInfo &Response = Waterfall.NetworkResponses.AddDefaulted_GetRef();
+            Response.AdLoadState = (EAdLoadState)FMath::Clamp(FCString::Atoi(*Fields[0]), 0, (int32)EAdLoadState::FailedToLoad);
+            Response.bIsBidding = Fields[1] == TEXT("1");
+            Response.LatencyMillis = FCString::Atoi64(*Fields[2]);
+            Response.ErrorCode = FCString::Atoi(*Fields[3]);
+            Response.NetworkName = MoveTemp(Fields[4]);
+            Response.ErrorMessage = MoveTemp(Fields[5]);
+        }
+
+        return Waterfall;
+    }
+
+} // namespace
+
+const FAdWaterfallInfo &FAdError::GetWaterfall() const
+{
+    if (!ParsedWaterfall.IsValid())
+    {
+        ParsedWaterfall = MakeShared<const FAdWaterfallInfo>(ParseWaterfall(WaterfallPayload));
+    }
+    return *ParsedWaterfall;
+}
+
+const FString &FAdError::GetWaterfallString() const
+{
+    if (Waterfall.IsEmpty() && !WaterfallPayload.IsEmpty())
+    {
+        // Payloads in an older or unknown format, such as the description sent by older iOS plugins, are kept as they are
+        Waterfall = WaterfallPayload.StartsWith(WaterfallVersionPrefix, ESearchCase::CaseSensitive) ? GetWaterfall().ToString() : WaterfallPayload;
+    }
+    return Waterfall;
+}
@@ -0,0 +1,14 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AdInventoryEviction.h"
+
+FString FAdInventoryEviction::ToString() const
+{
+    TArray<FStringFormatArg> Args;
+    Args.Add(FStringFormatArg(AdUnitIdentifier));
+    Args.Add(FStringFormatArg(StaticEnum<EAdInventoryFormat>()->GetNameStringByValue((int64)AdFormat)));
+    Args.Add(FStringFormatArg(FreedBytes));
+    Args.Add(FStringFormatArg(bIsRestored ? TEXT("true") : TEXT("false")));
+
+    return FString::Format(TEXT("[FAdInventoryEviction adUnitIdentifier: {0} adFormat: {1} freedBytes: {2} isRestored: {3}]"), Args);
+}
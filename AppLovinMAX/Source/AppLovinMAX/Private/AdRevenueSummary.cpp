@@ -0,0 +1,14 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AdRevenueSummary.h"
+
+FString FAdRevenueSummary::ToString() const
+{
+    TArray<FStringFormatArg> Args;
+    Args.Add(FStringFormatArg(Key));
+    Args.Add(FStringFormatArg(ImpressionCount));
+    Args.Add(FStringFormatArg(Revenue));
+    Args.Add(FStringFormatArg(RollingEcpm));
+
+    return FString::Format(TEXT("[FAdRevenueSummary key: {0} impressionCount: {1} revenue: {2} rollingEcpm: {3}]"), Args);
+}
@@ -0,0 +1,31 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AdWaterfallInfo.h"
+
+namespace
+{
+    const TCHAR *GetAdLoadStateString(EAdLoadState AdLoadState)
+    {
+        switch (AdLoadState)
+        {
+            case EAdLoadState::AdLoaded:     return TEXT("Loaded");
+            case EAdLoadState::FailedToLoad: return TEXT("Failed");
+            case EAdLoadState::AdLoadNotAttempted:
+            default:                         return TEXT("Not Attempted");
+        }
+    }
+} // namespace
+
+FString FAdWaterfallInfo::ToString() const
+{
+    FString Result = FString::Printf(TEXT("[FAdWaterfallInfo name: %s testName: %s latency: %lldms]"), *Name, *TestName, LatencyMillis);
+    for (const FAdNetworkResponseInfo &Response : NetworkResponses)
+    {
+        Result += FString::Printf(TEXT("\n    %s%s: %s in %lldms"), *Response.NetworkName, Response.bIsBidding ? TEXT(" (bidding)") : TEXT(""), GetAdLoadStateString(Response.AdLoadState), Response.LatencyMillis);
+        if (Response.AdLoadState == EAdLoadState::FailedToLoad)
+        {
+            Result += FString::Printf(TEXT(" (%d: %s)"), Response.ErrorCode, *Response.ErrorMessage);
+        }
+    }
+    return Result;
+}
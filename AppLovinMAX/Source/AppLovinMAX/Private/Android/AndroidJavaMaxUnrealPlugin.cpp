@@ -6,6 +6,7 @@
 
 #include "Android/AndroidApplication.h"
 #include "Android/AndroidJNI.h"
+#include "Misc/ScopeRWLock.h"
 
 FJavaAndroidMaxUnrealPlugin::FJavaAndroidMaxUnrealPlugin()
     : FJavaClassObject(GetClassName(), "(Landroid/app/Activity;)V", FAndroidApplication::GetGameActivityThis()),
@@ -31,33 +32,50 @@ FJavaAndroidMaxUnrealPlugin::FJavaAndroidMaxUnrealPlugin()
       SetCreativeDebuggerEnabledMethod(GetClassMethod("setCreativeDebuggerEnabled", "(Z)V")),
       SetTestDeviceAdvertisingIdentifiersMethod(GetClassMethod("setTestDeviceAdvertisingIds", "([Ljava/lang/String;)V")),
       TrackEventMethod(GetClassMethod("trackEvent", "(Ljava/lang/String;Ljava/lang/String;)V")),
-      CreateBannerMethod(GetClassMethod("createBanner", "(Ljava/lang/String;Ljava/lang/String;)V")),
+      TrackEventsMethod(GetClassMethod("trackEvents", "(Ljava/lang/String;)V")),
+      SetAdUnitHandleMethod(GetClassMethod("setAdUnitHandle", "(Ljava/lang/String;I)V")),
+      CreateBannerMethod(GetClassMethod("createBanner", "(Ljava/lang/String;I)V")),
       SetBannerBackgroundColorMethod(GetClassMethod("setBannerBackgroundColor", "(Ljava/lang/String;Ljava/lang/String;)V")),
       SetBannerPlacementMethod(GetClassMethod("setBannerPlacement", "(Ljava/lang/String;Ljava/lang/String;)V")),
       SetBannerExtraParameterMethod(GetClassMethod("setBannerExtraParameter", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V")),
-      UpdateBannerPositionMethod(GetClassMethod("updateBannerPosition", "(Ljava/lang/String;Ljava/lang/String;)V")),
+      UpdateBannerPositionMethod(GetClassMethod("updateBannerPosition", "(Ljava/lang/String;I)V")),
       ShowBannerMethod(GetClassMethod("showBanner", "(Ljava/lang/String;)V")),
       HideBannerMethod(GetClassMethod("hideBanner", "(Ljava/lang/String;)V")),
       DestroyBannerMethod(GetClassMethod("destroyBanner", "(Ljava/lang/String;)V")),
-      CreateMRecMethod(GetClassMethod("createMRec", "(Ljava/lang/String;Ljava/lang/String;)V")),
+      CreateMRecMethod(GetClassMethod("createMRec", "(Ljava/lang/String;I)V")),
       SetMRecPlacementMethod(GetClassMethod("setMRecPlacement", "(Ljava/lang/String;Ljava/lang/String;)V")),
       SetMRecExtraParameterMethod(GetClassMethod("setMRecExtraParameter", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V")),
-      UpdateMRecPositionMethod(GetClassMethod("updateMRecPosition", "(Ljava/lang/String;Ljava/lang/String;)V")),
+      UpdateMRecPositionMethod(GetClassMethod("updateMRecPosition", "(Ljava/lang/String;I)V")),
       ShowMRecMethod(GetClassMethod("showMRec", "(Ljava/lang/String;)V")),
       HideMRecMethod(GetClassMethod("hideMRec", "(Ljava/lang/String;)V")),
       DestroyMRecMethod(GetClassMethod("destroyMRec", "(Ljava/lang/String;)V")),
+      ApplyAdViewCommandsMethod(GetClassMethod("applyAdViewCommands", "(Ljava/lang/String;)V")),
       LoadInterstitialMethod(GetClassMethod("loadInterstitial", "(Ljava/lang/String;)V")),
       IsInterstitialReadyMethod(GetClassMethod("isInterstitialReady", "(Ljava/lang/String;)Z")),
       ShowInterstitialMethod(GetClassMethod("showInterstitial", "(Ljava/lang/String;Ljava/lang/String;)V")),
       SetInterstitialExtraParameterMethod(GetClassMethod("setInterstitialExtraParameter", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V")),
+      DestroyInterstitialMethod(GetClassMethod("destroyInterstitial", "(Ljava/lang/String;)V")),
       LoadRewardedAdMethod(GetClassMethod("loadRewardedAd", "(Ljava/lang/String;)V")),
       IsRewardedAdReadyMethod(GetClassMethod("isRewardedAdReady", "(Ljava/lang/String;)Z")),
       ShowRewardedAdMethod(GetClassMethod("showRewardedAd", "(Ljava/lang/String;Ljava/lang/String;)V")),
-      SetRewardedAdExtraParameterMethod(GetClassMethod("setRewardedAdExtraParameter", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V"))
+      SetRewardedAdExtraParameterMethod(GetClassMethod("setRewardedAdExtraParameter", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V")),
+      DestroyRewardedAdMethod(GetClassMethod("destroyRewardedAd", "(Ljava/lang/String;)V")),
+      ListenerClass(FAndroidApplication::FindJavaClassGlobalRef("com/epicgames/unreal/GameActivity$MaxUnrealPluginListener")),
+      ListenerConstructor(FAndroidApplication::GetJavaEnv()->GetMethodID(ListenerClass, "<init>", "()V"))
 {
 }
 
-FJavaAndroidMaxUnrealPlugin::~FJavaAndroidMaxUnrealPlugin() {}
+FJavaAndroidMaxUnrealPlugin::~FJavaAndroidMaxUnrealPlugin()
+{
+    JNIEnv *JEnv = FAndroidApplication::GetJavaEnv();
+
+    for (const TPair<FString, jstring> &Pair : InternedAdUnitJStrings)
+    {
+        JEnv->DeleteGlobalRef(Pair.Value);
+    }
+
+    JEnv->DeleteGlobalRef(ListenerClass);
+}
 
 // MARK: - Initialization
 
@@ -66,11 +84,7 @@ void FJavaAndroidMaxUnrealPlugin::Initialize(const FString &PluginVersion, const
     JNIEnv *JEnv = FAndroidApplication::GetJavaEnv();
 
     // Create listener for Android plugin event handling
-    jclass ListenerClass;
-    ListenerClass = FAndroidApplication::FindJavaClass("com/epicgames/unreal/GameActivity$MaxUnrealPluginListener");
-
-    jmethodID Constructor = JEnv->GetMethodID(ListenerClass, "<init>", "()V");
-    auto LocalListener = NewScopedJavaObject(JEnv, JEnv->NewObject(ListenerClass, Constructor));
+    auto LocalListener = NewScopedJavaObject(JEnv, JEnv->NewObject(ListenerClass, ListenerConstructor));
 
     CallMethod<void>(InitializeMethod, *GetJString(PluginVersion), *GetJString(SdkKey), *LocalListener);
 }
@@ -198,127 +212,156 @@ void FJavaAndroidMaxUnrealPlugin::TrackEvent(const FString &Name, const FString
     CallMethod<void>(TrackEventMethod, *GetJString(Name), *GetJString(Parameters));
 }
 
+void FJavaAndroidMaxUnrealPlugin::TrackEvents(const FString &SerializedEvents)
+{
+    CallMethod<void>(TrackEventsMethod, *GetJString(SerializedEvents));
+}
+
+// MARK: - Ad Units
+
+void FJavaAndroidMaxUnrealPlugin::SetAdUnitHandle(const FString &AdUnitIdentifier, int32 Handle)
+{
+    CallMethod<void>(SetAdUnitHandleMethod, *GetAdUnitJString(AdUnitIdentifier), (jint)Handle);
+}
+
 // MARK: - Banners
 
-void FJavaAndroidMaxUnrealPlugin::CreateBanner(const FString &AdUnitIdentifier, const FString &BannerPosition)
+void FJavaAndroidMaxUnrealPlugin::CreateBanner(const FString &AdUnitIdentifier, int32 BannerPosition)
 {
-    return CallMethod<void>(CreateBannerMethod, *GetJString(AdUnitIdentifier), *GetJString(BannerPosition));
+    return CallMethod<void>(CreateBannerMethod, *GetAdUnitJString(AdUnitIdentifier), (jint)BannerPosition);
 }
 
 void FJavaAndroidMaxUnrealPlugin::SetBannerBackgroundColor(const FString &AdUnitIdentifier, const FString &HexColorCode)
 {
-    return CallMethod<void>(SetBannerBackgroundColorMethod, *GetJString(AdUnitIdentifier), *GetJString(HexColorCode));
+    return CallMethod<void>(SetBannerBackgroundColorMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(HexColorCode));
 }
 
 void FJavaAndroidMaxUnrealPlugin::SetBannerPlacement(const FString &AdUnitIdentifier, const FString &Placement)
 {
-    return CallMethod<void>(SetBannerPlacementMethod, *GetJString(AdUnitIdentifier), *GetJString(Placement));
+    return CallMethod<void>(SetBannerPlacementMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(Placement));
 }
 
 void FJavaAndroidMaxUnrealPlugin::SetBannerExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
 {
-    return CallMethod<void>(SetBannerExtraParameterMethod, *GetJString(AdUnitIdentifier), *GetJString(Key), *GetJString(Value));
+    return CallMethod<void>(SetBannerExtraParameterMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(Key), *GetJString(Value));
 }
 
-void FJavaAndroidMaxUnrealPlugin::UpdateBannerPosition(const FString &AdUnitIdentifier, const FString &BannerPosition)
+void FJavaAndroidMaxUnrealPlugin::UpdateBannerPosition(const FString &AdUnitIdentifier, int32 BannerPosition)
 {
-    return CallMethod<void>(UpdateBannerPositionMethod, *GetJString(AdUnitIdentifier), *GetJString(BannerPosition));
+    return CallMethod<void>(UpdateBannerPositionMethod, *GetAdUnitJString(AdUnitIdentifier), (jint)BannerPosition);
 }
 
 void FJavaAndroidMaxUnrealPlugin::ShowBanner(const FString &AdUnitIdentifier)
 {
-    return CallMethod<void>(ShowBannerMethod, *GetJString(AdUnitIdentifier));
+    return CallMethod<void>(ShowBannerMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 void FJavaAndroidMaxUnrealPlugin::HideBanner(const FString &AdUnitIdentifier)
 {
-    return CallMethod<void>(HideBannerMethod, *GetJString(AdUnitIdentifier));
+    return CallMethod<void>(HideBannerMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 void FJavaAndroidMaxUnrealPlugin::DestroyBanner(const FString &AdUnitIdentifier)
 {
-    return CallMethod<void>(DestroyBannerMethod, *GetJString(AdUnitIdentifier));
+    return CallMethod<void>(DestroyBannerMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 // MARK: - MRECs
 
-void FJavaAndroidMaxUnrealPlugin::CreateMRec(const FString &AdUnitIdentifier, const FString &MRecPosition)
+void FJavaAndroidMaxUnrealPlugin::CreateMRec(const FString &AdUnitIdentifier, int32 MRecPosition)
 {
-    return CallMethod<void>(CreateMRecMethod, *GetJString(AdUnitIdentifier), *GetJString(MRecPosition));
+    return CallMethod<void>(CreateMRecMethod, *GetAdUnitJString(AdUnitIdentifier), (jint)MRecPosition);
 }
 
 void FJavaAndroidMaxUnrealPlugin::SetMRecPlacement(const FString &AdUnitIdentifier, const FString &Placement)
 {
-    return CallMethod<void>(SetMRecPlacementMethod, *GetJString(AdUnitIdentifier), *GetJString(Placement));
+    return CallMethod<void>(SetMRecPlacementMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(Placement));
 }
 
 void FJavaAndroidMaxUnrealPlugin::SetMRecExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
 {
-    return CallMethod<void>(SetMRecExtraParameterMethod, *GetJString(AdUnitIdentifier), *GetJString(Key), *GetJString(Value));
+    return CallMethod<void>(SetMRecExtraParameterMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(Key), *GetJString(Value));
 }
 
-void FJavaAndroidMaxUnrealPlugin::UpdateMRecPosition(const FString &AdUnitIdentifier, const FString &MRecPosition)
+void FJavaAndroidMaxUnrealPlugin::UpdateMRecPosition(const FString &AdUnitIdentifier, int32 MRecPosition)
 {
-    return CallMethod<void>(UpdateMRecPositionMethod, *GetJString(AdUnitIdentifier), *GetJString(MRecPosition));
+    return CallMethod<void>(UpdateMRecPositionMethod, *GetAdUnitJString(AdUnitIdentifier), (jint)MRecPosition);
 }
 
 void FJavaAndroidMaxUnrealPlugin::ShowMRec(const FString &AdUnitIdentifier)
 {
-    return CallMethod<void>(ShowMRecMethod, *GetJString(AdUnitIdentifier));
+    return CallMethod<void>(ShowMRecMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 void FJavaAndroidMaxUnrealPlugin::HideMRec(const FString &AdUnitIdentifier)
 {
-    return CallMethod<void>(HideMRecMethod, *GetJString(AdUnitIdentifier));
+    return CallMethod<void>(HideMRecMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 void FJavaAndroidMaxUnrealPlugin::DestroyMRec(const FString &AdUnitIdentifier)
 {
-    return CallMethod<void>(DestroyMRecMethod, *GetJString(AdUnitIdentifier));
+    return CallMethod<void>(DestroyMRecMethod, *GetAdUnitJString(AdUnitIdentifier));
+}
+
+// MARK: - Ad View Commands
+
+void FJavaAndroidMaxUnrealPlugin::ApplyAdViewCommands(const FString &SerializedCommands)
+{
+    CallMethod<void>(ApplyAdViewCommandsMethod, *GetJString(SerializedCommands));
 }
 
 // MARK: - Interstitials
 
 void FJavaAndroidMaxUnrealPlugin::LoadInterstitial(const FString &AdUnitIdentifier)
 {
-    CallMethod<void>(LoadInterstitialMethod, *GetJString(AdUnitIdentifier));
+    CallMethod<void>(LoadInterstitialMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 bool FJavaAndroidMaxUnrealPlugin::IsInterstitialReady(const FString &AdUnitIdentifier)
 {
-    return CallMethod<bool>(IsInterstitialReadyMethod, *GetJString(AdUnitIdentifier));
+    return CallMethod<bool>(IsInterstitialReadyMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 void FJavaAndroidMaxUnrealPlugin::ShowInterstitial(const FString &AdUnitIdentifier, const FString &Placement)
 {
-    CallMethod<void>(ShowInterstitialMethod, *GetJString(AdUnitIdentifier), *GetJString(Placement));
+    CallMethod<void>(ShowInterstitialMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(Placement));
 }
 
 void FJavaAndroidMaxUnrealPlugin::SetInterstitialExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
 {
-    CallMethod<void>(SetInterstitialExtraParameterMethod, *GetJString(AdUnitIdentifier), *GetJString(Key), *GetJString(Value));
+    CallMethod<void>(SetInterstitialExtraParameterMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(Key), *GetJString(Value));
+}
+
+void FJavaAndroidMaxUnrealPlugin::DestroyInterstitial(const FString &AdUnitIdentifier)
+{
+    CallMethod<void>(DestroyInterstitialMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 // MARK: - Rewarded
 
 void FJavaAndroidMaxUnrealPlugin::LoadRewardedAd(const FString &AdUnitIdentifier)
 {
-    CallMethod<void>(LoadRewardedAdMethod, *GetJString(AdUnitIdentifier));
+    CallMethod<void>(LoadRewardedAdMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 bool FJavaAndroidMaxUnrealPlugin::IsRewardedAdReady(const FString &AdUnitIdentifier)
 {
-    return CallMethod<bool>(IsRewardedAdReadyMethod, *GetJString(AdUnitIdentifier));
+    return CallMethod<bool>(IsRewardedAdReadyMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 void FJavaAndroidMaxUnrealPlugin::ShowRewardedAd(const FString &AdUnitIdentifier, const FString &Placement)
 {
-    CallMethod<void>(ShowRewardedAdMethod, *GetJString(AdUnitIdentifier), *GetJString(Placement));
+    CallMethod<void>(ShowRewardedAdMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(Placement));
 }
 
 void FJavaAndroidMaxUnrealPlugin::SetRewardedAdExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
 {
-    CallMethod<void>(SetRewardedAdExtraParameterMethod, *GetJString(AdUnitIdentifier), *GetJString(Key), *GetJString(Value));
+    CallMethod<void>(SetRewardedAdExtraParameterMethod, *GetAdUnitJString(AdUnitIdentifier), *GetJString(Key), *GetJString(Value));
+}
+
+void FJavaAndroidMaxUnrealPlugin::DestroyRewardedAd(const FString &AdUnitIdentifier)
+{
+    CallMethod<void>(DestroyRewardedAdMethod, *GetAdUnitJString(AdUnitIdentifier));
 }
 
 // MARK: - Private
@@ -328,4 +371,34 @@ FName FJavaAndroidMaxUnrealPlugin::GetClassName()
     return FName("com/applovin/unreal/MaxUnrealPlugin");
 }
 
+FJavaAndroidMaxUnrealPlugin::FAdUnitJString FJavaAndroidMaxUnrealPlugin::GetAdUnitJString(const FString &AdUnitIdentifier)
+{
+    FAdUnitJString AdUnitJString;
+    {
+        FReadScopeLock ReadLock(InternedAdUnitJStringsLock);
+        if (const jstring *Interned = InternedAdUnitJStrings.Find(AdUnitIdentifier))
+        {
+            AdUnitJString.Interned = *Interned;
+            return AdUnitJString;
+        }
+    }
+
+    FWriteScopeLock WriteLock(InternedAdUnitJStringsLock);
+    if (const jstring *Interned = InternedAdUnitJStrings.Find(AdUnitIdentifier))
+    {
+        AdUnitJString.Interned = *Interned;
+    }
+    else if (InternedAdUnitJStrings.Num() < FAdUnitHandle::MaxAdUnits)
+    {
+        JNIEnv *JEnv = FAndroidApplication::GetJavaEnv();
+        AdUnitJString.Interned = (jstring)JEnv->NewGlobalRef(*GetJString(AdUnitIdentifier));
+        InternedAdUnitJStrings.Add(AdUnitIdentifier, AdUnitJString.Interned);
+    }
+    else
+    {
+        AdUnitJString.Local.Emplace(GetJString(AdUnitIdentifier));
+    }
+    return AdUnitJString;
+}
+
 #endif
@@ -6,6 +6,8 @@
 
 #if PLATFORM_ANDROID
 #include "Android/AndroidJava.h"
+#include "AdUnitHandle.h"
+#include "HAL/CriticalSection.h"
 
 // Wrapper for com/applovin/unreal/MaxUnrealPlugin.java.
 class FJavaAndroidMaxUnrealPlugin : public FJavaClassObject
@@ -45,41 +47,65 @@ public:
 
     // MARK: Event Tracking
     void TrackEvent(const FString &Name, const FString &Parameters);
+    void TrackEvents(const FString &SerializedEvents);
+
+    // MARK: Ad Units
+    void SetAdUnitHandle(const FString &AdUnitIdentifier, int32 Handle);
 
     // MARK: Banners
-    void CreateBanner(const FString &AdUnitIdentifier, const FString &BannerPosition);
+    void CreateBanner(const FString &AdUnitIdentifier, int32 BannerPosition);
     void SetBannerBackgroundColor(const FString &AdUnitIdentifier, const FString &HexColorCode);
     void SetBannerPlacement(const FString &AdUnitIdentifier, const FString &Placement);
     void SetBannerExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value);
-    void UpdateBannerPosition(const FString &AdUnitIdentifier, const FString &BannerPosition);
+    void UpdateBannerPosition(const FString &AdUnitIdentifier, int32 BannerPosition);
     void ShowBanner(const FString &AdUnitIdentifier);
     void HideBanner(const FString &AdUnitIdentifier);
     void DestroyBanner(const FString &AdUnitIdentifier);
 
     // MARK: MRECs
-    void CreateMRec(const FString &AdUnitIdentifier, const FString &MRecPosition);
+    void CreateMRec(const FString &AdUnitIdentifier, int32 MRecPosition);
     void SetMRecPlacement(const FString &AdUnitIdentifier, const FString &Placement);
     void SetMRecExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value);
-    void UpdateMRecPosition(const FString &AdUnitIdentifier, const FString &MRecPosition);
+    void UpdateMRecPosition(const FString &AdUnitIdentifier, int32 MRecPosition);
     void ShowMRec(const FString &AdUnitIdentifier);
     void HideMRec(const FString &AdUnitIdentifier);
     void DestroyMRec(const FString &AdUnitIdentifier);
 
+    // MARK: Ad View Commands
+    void ApplyAdViewCommands(const FString &SerializedCommands);
+
     // MARK: Interstitials
     void LoadInterstitial(const FString &AdUnitIdentifier);
     bool IsInterstitialReady(const FString &AdUnitIdentifier);
     void ShowInterstitial(const FString &AdUnitIdentifier, const FString &Placement);
     void SetInterstitialExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value);
+    void DestroyInterstitial(const FString &AdUnitIdentifier);
 
     // MARK: Rewarded
     void LoadRewardedAd(const FString &AdUnitIdentifier);
     bool IsRewardedAdReady(const FString &AdUnitIdentifier);
     void ShowRewardedAd(const FString &AdUnitIdentifier, const FString &Placement);
     void SetRewardedAdExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value);
+    void DestroyRewardedAd(const FString &AdUnitIdentifier);
 
 private:
     static FName GetClassName();
 
+    // An ad unit identifier as a Java string: the interned global reference, or a local reference once the interned set is full
+    struct FAdUnitJString
+    {
+        jstring Interned = nullptr;
+        TOptional<FScopedJavaObject<jstring>> Local;
+
+        jstring operator*() const { return Interned ? Interned : **Local; }
+    };
+
+    /**
+     * Returns the ad unit identifier as a Java string, interning a global reference to it on first use.
+     * At most FAdUnitHandle::MaxAdUnits identifiers are interned, so that the global references stay bounded; others get a local reference.
+     */
+    FAdUnitJString GetAdUnitJString(const FString &AdUnitIdentifier);
+
     FJavaClassMethod InitializeMethod;
     FJavaClassMethod IsInitializedMethod;
 
@@ -109,6 +135,9 @@ private:
     FJavaClassMethod SetTestDeviceAdvertisingIdentifiersMethod;
 
     FJavaClassMethod TrackEventMethod;
+    FJavaClassMethod TrackEventsMethod;
+
+    FJavaClassMethod SetAdUnitHandleMethod;
 
     FJavaClassMethod CreateBannerMethod;
     FJavaClassMethod SetBannerBackgroundColorMethod;
@@ -127,15 +156,26 @@ private:
     FJavaClassMethod HideMRecMethod;
     FJavaClassMethod DestroyMRecMethod;
 
+    FJavaClassMethod ApplyAdViewCommandsMethod;
+
     FJavaClassMethod LoadInterstitialMethod;
     FJavaClassMethod IsInterstitialReadyMethod;
     FJavaClassMethod ShowInterstitialMethod;
     FJavaClassMethod SetInterstitialExtraParameterMethod;
+    FJavaClassMethod DestroyInterstitialMethod;
 
     FJavaClassMethod LoadRewardedAdMethod;
     FJavaClassMethod IsRewardedAdReadyMethod;
     FJavaClassMethod ShowRewardedAdMethod;
     FJavaClassMethod SetRewardedAdExtraParameterMethod;
+    FJavaClassMethod DestroyRewardedAdMethod;
+
+    // Resolved once on construction so that Initialize does not look them up on the calling thread
+    jclass ListenerClass;
+    jmethodID ListenerConstructor;
+
+    FRWLock InternedAdUnitJStringsLock;
+    TMap<FString, jstring> InternedAdUnitJStrings;
 };
 
 #endif
@@ -1,11 +1,25 @@
 // Copyright AppLovin Corporation. All Rights Reserved.
 
 #include "AppLovinMAX.h"
+#include "AppLovinMAXAdInventory.h"
+#include "AppLovinMAXAdReadiness.h"
+#include "AppLovinMAXAdUnitListeners.h"
+#include "AppLovinMAXAdUnits.h"
 #include "AppLovinMAXDelegate.h"
+#include "AppLovinMAXEvent.h"
+#include "AppLovinMAXEventDecoder.h"
+#include "AppLovinMAXEventQueue.h"
+#include "AppLovinMAXEventRecorder.h"
+#include "AppLovinMAXFullscreenThrottle.h"
 #include "AppLovinMAXLogger.h"
+#include "AppLovinMAXRevenue.h"
+#include "AppLovinMAXSdkState.h"
+#include "AppLovinMAXStartup.h"
+#include "AppLovinMAXTrace.h"
 #include "AppLovinMAXUtils.h"
+#include "Async/Async.h"
 #include "Interfaces/IPluginManager.h"
-#include "Runtime/JsonUtilities/Public/JsonObjectConverter.h"
+#include <atomic>
 
 #if PLATFORM_IOS
 #include "IOS/IOSAppDelegate.h"
@@ -15,33 +29,121 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 
 #elif PLATFORM_ANDROID
+#include "AppLovinMAXAdViewCommandBuffer.h"
+#include "AppLovinMAXEventBatch.h"
 #include "Android/AndroidJavaMaxUnrealPlugin.h"
 #include "Android/AndroidApplication.h"
 #include "Android/AndroidJNI.h"
+#else
+#include "AppLovinMAXMockPlugin.h"
 #endif
 
 // MARK: - Initialization
 
+namespace
+{
+    FString GetPluginVersion()
+    {
+        TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin("AppLovinMAX");
+        return Plugin->GetDescriptor().VersionName;
+    }
+} // namespace
+
 void UAppLovinMAX::Initialize(const FString &SdkKey)
 {
-    TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin("AppLovinMAX");
-    FString PluginVersion = Plugin->GetDescriptor().VersionName;
+    MAX_DEFER_UNTIL_INITIALIZED(Initialize, SdkKey);
+    MAX_TRACE_BRIDGE_CALL(Initialize);
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    FString PluginVersion = GetPluginVersion();
 
 #if PLATFORM_IOS
     [GetIOSPlugin() initialize:PluginVersion.GetNSString() sdkKey:SdkKey.GetNSString()];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->Initialize(PluginVersion, SdkKey);
+#else
+    GetMockPlugin()->Initialize();
+#endif
+
+    AppLovinMAXStartup::RecordInitializeCall(StartCycles);
+}
+
+namespace
+{
+    // Replays the deferred calls on the game thread, where they would have run had they not been deferred, then resolves the promise
+    void FinishInitializeAsync(const TSharedRef<TPromise<void>, ESPMode::ThreadSafe> &Promise)
+    {
+        AsyncTask(ENamedThreads::GameThread, [Promise]()
+        {
+            AppLovinMAXStartup::FinishDeferring();
+            Promise->SetValue();
+        });
+    }
+} // namespace
+
+TFuture<void> UAppLovinMAX::InitializeAsync(const FString &SdkKey)
+{
+    MAX_TRACE_BRIDGE_CALL(InitializeAsync);
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    TSharedRef<TPromise<void>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<void>, ESPMode::ThreadSafe>();
+    TFuture<void> Future = Promise->GetFuture();
+
+    if (!AppLovinMAXStartup::TryBeginDeferring())
+    {
+        // Already initializing: initialize again once that finishes, like any other call made in the meantime
+        TFunction<void()> Call = [SdkKey, Promise]()
+        {
+            Initialize(SdkKey);
+            Promise->SetValue();
+        };
+        if (!AppLovinMAXStartup::DeferCall(Call))
+        {
+            Call();
+        }
+        return Future;
+    }
+
+    Async(EAsyncExecution::TaskGraph, [SdkKey, Promise]()
+    {
+        MAX_TRACE_SCOPE("AppLovinMAX::InitializeAsync");
+
+        const uint64 PluginStartCycles = FPlatformTime::Cycles64();
+        FString PluginVersion = GetPluginVersion();
+
+#if PLATFORM_IOS
+        // The plugin is created with the main view, so UIKit requires it to be created on the main thread
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [GetIOSPlugin() initialize:PluginVersion.GetNSString() sdkKey:SdkKey.GetNSString()];
+            AppLovinMAXStartup::RecordPluginStartup(PluginStartCycles);
+            FinishInitializeAsync(Promise);
+        });
+#else
+        // Resolves the Java class, its method IDs and the listener class on this thread instead of the first caller's
+#if PLATFORM_ANDROID
+        GetAndroidPlugin()->Initialize(PluginVersion, SdkKey);
+#else
+        GetMockPlugin()->Initialize();
 #endif
+        AppLovinMAXStartup::RecordPluginStartup(PluginStartCycles);
+        FinishInitializeAsync(Promise);
+#endif
+    });
+
+    AppLovinMAXStartup::RecordInitializeCall(StartCycles);
+    return Future;
 }
 
 bool UAppLovinMAX::IsInitialized()
 {
+    MAX_TRACE_BRIDGE_CALL(IsInitialized);
+
 #if PLATFORM_IOS
     return [GetIOSPlugin() isInitialized];
 #elif PLATFORM_ANDROID
     return GetAndroidPlugin()->IsInitialized();
 #else
-    return false;
+    return GetMockPlugin()->IsInitialized();
 #endif
 }
 
@@ -49,48 +151,69 @@ bool UAppLovinMAX::IsInitialized()
 
 void UAppLovinMAX::SetHasUserConsent(bool bHasUserConsent)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetHasUserConsent, bHasUserConsent);
+    MAX_TRACE_BRIDGE_CALL(SetHasUserConsent);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setHasUserConsent:bHasUserConsent];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->SetHasUserConsent(bHasUserConsent);
 #endif
+    AppLovinMAXSdkState::HasUserConsent.Set(bHasUserConsent);
 }
 
 bool UAppLovinMAX::HasUserConsent()
 {
+    return AppLovinMAXSdkState::HasUserConsent.Get([]() -> bool
+    {
+        MAX_TRACE_BRIDGE_CALL(HasUserConsent);
+
 #if PLATFORM_IOS
-    return [GetIOSPlugin() hasUserConsent];
+        return [GetIOSPlugin() hasUserConsent];
 #elif PLATFORM_ANDROID
-    return GetAndroidPlugin()->HasUserConsent();
+        return GetAndroidPlugin()->HasUserConsent();
 #else
-    return false;
+        return false;
 #endif
+    });
 }
 
 void UAppLovinMAX::SetDoNotSell(bool bDoNotSell)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetDoNotSell, bDoNotSell);
+    MAX_TRACE_BRIDGE_CALL(SetDoNotSell);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setDoNotSell:bDoNotSell];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->SetDoNotSell(bDoNotSell);
 #endif
+    AppLovinMAXSdkState::DoNotSell.Set(bDoNotSell);
 }
 
 bool UAppLovinMAX::IsDoNotSell()
 {
+    return AppLovinMAXSdkState::DoNotSell.Get([]() -> bool
+    {
+        MAX_TRACE_BRIDGE_CALL(IsDoNotSell);
+
 #if PLATFORM_IOS
-    return [GetIOSPlugin() isDoNotSell];
+        return [GetIOSPlugin() isDoNotSell];
 #elif PLATFORM_ANDROID
-    return GetAndroidPlugin()->IsDoNotSell();
+        return GetAndroidPlugin()->IsDoNotSell();
 #else
-    return false;
+        return false;
 #endif
+    });
 }
 
 // MARK: - Terms and Privacy Policy Flow
 
 void UAppLovinMAX::SetTermsAndPrivacyPolicyFlowEnabled(bool bEnabled)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetTermsAndPrivacyPolicyFlowEnabled, bEnabled);
+    MAX_TRACE_BRIDGE_CALL(SetTermsAndPrivacyPolicyFlowEnabled);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setTermsAndPrivacyPolicyFlowEnabled:bEnabled];
 #elif PLATFORM_ANDROID
@@ -100,6 +223,9 @@ void UAppLovinMAX::SetTermsAndPrivacyPolicyFlowEnabled(bool bEnabled)
 
 void UAppLovinMAX::SetPrivacyPolicyUrl(const FString &Url)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetPrivacyPolicyUrl, Url);
+    MAX_TRACE_BRIDGE_CALL(SetPrivacyPolicyUrl);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setPrivacyPolicyURL:Url.GetNSString()];
 #elif PLATFORM_ANDROID
@@ -109,6 +235,9 @@ void UAppLovinMAX::SetPrivacyPolicyUrl(const FString &Url)
 
 void UAppLovinMAX::SetTermsOfServiceUrl(const FString &Url)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetTermsOfServiceUrl, Url);
+    MAX_TRACE_BRIDGE_CALL(SetTermsOfServiceUrl);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setTermsOfServiceURL:Url.GetNSString()];
 #elif PLATFORM_ANDROID
@@ -118,9 +247,12 @@ void UAppLovinMAX::SetTermsOfServiceUrl(const FString &Url)
 
 void UAppLovinMAX::SetConsentFlowDebugUserGeography(EConsentFlowUserGeography UserGeography)
 {
-    const FString UserGeographyString = GetUserGeographyString(UserGeography);
+    MAX_DEFER_UNTIL_INITIALIZED(SetConsentFlowDebugUserGeography, UserGeography);
+    MAX_TRACE_BRIDGE_CALL(SetConsentFlowDebugUserGeography);
+
+    const TCHAR *UserGeographyString = GetUserGeographyString(UserGeography);
 #if PLATFORM_IOS
-    [GetIOSPlugin() setConsentFlowDebugUserGeography:UserGeographyString.GetNSString()];
+    [GetIOSPlugin() setConsentFlowDebugUserGeography:[NSString stringWithUTF8String:TCHAR_TO_UTF8(UserGeographyString)]];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->SetConsentFlowDebugUserGeography(UserGeographyString);
 #endif
@@ -128,6 +260,9 @@ void UAppLovinMAX::SetConsentFlowDebugUserGeography(EConsentFlowUserGeography Us
 
 void UAppLovinMAX::ShowCmpForExistingUser()
 {
+    MAX_DEFER_UNTIL_INITIALIZED(ShowCmpForExistingUser);
+    MAX_TRACE_BRIDGE_CALL(ShowCmpForExistingUser);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() showCMPForExistingUser];
 #elif PLATFORM_ANDROID
@@ -137,6 +272,8 @@ void UAppLovinMAX::ShowCmpForExistingUser()
 
 bool UAppLovinMAX::HasSupportedCmp()
 {
+    MAX_TRACE_BRIDGE_CALL(HasSupportedCmp);
+
 #if PLATFORM_IOS
     return [GetIOSPlugin() hasSupportedCMP];
 #elif PLATFORM_ANDROID
@@ -150,17 +287,25 @@ bool UAppLovinMAX::HasSupportedCmp()
 
 bool UAppLovinMAX::IsTablet()
 {
+    return AppLovinMAXSdkState::Tablet.Get([]() -> bool
+    {
+        MAX_TRACE_BRIDGE_CALL(IsTablet);
+
 #if PLATFORM_IOS
-    return [GetIOSPlugin() isTablet];
+        return [GetIOSPlugin() isTablet];
 #elif PLATFORM_ANDROID
-    return GetAndroidPlugin()->IsTablet();
+        return GetAndroidPlugin()->IsTablet();
 #else
-    return false;
+        return false;
 #endif
+    });
 }
 
 void UAppLovinMAX::ShowMediationDebugger()
 {
+    MAX_DEFER_UNTIL_INITIALIZED(ShowMediationDebugger);
+    MAX_TRACE_BRIDGE_CALL(ShowMediationDebugger);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() showMediationDebugger];
 #elif PLATFORM_ANDROID
@@ -170,6 +315,9 @@ void UAppLovinMAX::ShowMediationDebugger()
 
 void UAppLovinMAX::SetUserId(const FString &UserId)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetUserId, UserId);
+    MAX_TRACE_BRIDGE_CALL(SetUserId);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setUserId:UserId.GetNSString()];
 #elif PLATFORM_ANDROID
@@ -179,46 +327,67 @@ void UAppLovinMAX::SetUserId(const FString &UserId)
 
 void UAppLovinMAX::SetMuted(bool bMuted)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetMuted, bMuted);
+    MAX_TRACE_BRIDGE_CALL(SetMuted);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setMuted:bMuted];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->SetMuted(bMuted);
 #endif
+    AppLovinMAXSdkState::Muted.Set(bMuted);
 }
 
 bool UAppLovinMAX::IsMuted()
 {
+    return AppLovinMAXSdkState::Muted.Get([]() -> bool
+    {
+        MAX_TRACE_BRIDGE_CALL(IsMuted);
+
 #if PLATFORM_IOS
-    return [GetIOSPlugin() isMuted];
+        return [GetIOSPlugin() isMuted];
 #elif PLATFORM_ANDROID
-    return GetAndroidPlugin()->IsMuted();
+        return GetAndroidPlugin()->IsMuted();
 #else
-    return false;
+        return false;
 #endif
+    });
 }
 
 void UAppLovinMAX::SetVerboseLoggingEnabled(bool bEnabled)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetVerboseLoggingEnabled, bEnabled);
+    MAX_TRACE_BRIDGE_CALL(SetVerboseLoggingEnabled);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setVerboseLoggingEnabled:bEnabled];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->SetVerboseLoggingEnabled(bEnabled);
 #endif
+    AppLovinMAXSdkState::VerboseLoggingEnabled.Set(bEnabled);
 }
 
 bool UAppLovinMAX::IsVerboseLoggingEnabled()
 {
+    return AppLovinMAXSdkState::VerboseLoggingEnabled.Get([]() -> bool
+    {
+        MAX_TRACE_BRIDGE_CALL(IsVerboseLoggingEnabled);
+
 #if PLATFORM_IOS
-    return [GetIOSPlugin() isVerboseLoggingEnabled];
+        return [GetIOSPlugin() isVerboseLoggingEnabled];
 #elif PLATFORM_ANDROID
-    return GetAndroidPlugin()->IsVerboseLoggingEnabled();
+        return GetAndroidPlugin()->IsVerboseLoggingEnabled();
 #else
-    return false;
+        return false;
 #endif
+    });
 }
 
 void UAppLovinMAX::SetCreativeDebuggerEnabled(bool bEnabled)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetCreativeDebuggerEnabled, bEnabled);
+    MAX_TRACE_BRIDGE_CALL(SetCreativeDebuggerEnabled);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setCreativeDebuggerEnabled:bEnabled];
 #elif PLATFORM_ANDROID
@@ -228,6 +397,9 @@ void UAppLovinMAX::SetCreativeDebuggerEnabled(bool bEnabled)
 
 void UAppLovinMAX::SetTestDeviceAdvertisingIdentifiers(const TArray<FString> &AdvertisingIdentifiers)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetTestDeviceAdvertisingIdentifiers, AdvertisingIdentifiers);
+    MAX_TRACE_BRIDGE_CALL(SetTestDeviceAdvertisingIdentifiers);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() setTestDeviceAdvertisingIds:GetNSArray(AdvertisingIdentifiers)];
 #elif PLATFORM_ANDROID
@@ -237,6 +409,13 @@ void UAppLovinMAX::SetTestDeviceAdvertisingIdentifiers(const TArray<FString> &Ad
 
 // MARK: - Event Tracking
 
+#if PLATFORM_ANDROID
+namespace
+{
+    std::atomic<bool> bIsEventBatchingEnabled{false};
+} // namespace
+#endif
+
 void UAppLovinMAX::TrackEvent(const FString &Name)
 {
     TMap<FString, FString> EmptyParameters;
@@ -245,96 +424,306 @@ void UAppLovinMAX::TrackEvent(const FString &Name)
 
 void UAppLovinMAX::TrackEvent(const FString &Name, const TMap<FString, FString> &Parameters)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(TrackEvent, Name, Parameters);
+    MAX_TRACE_BRIDGE_CALL(TrackEvent);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() trackEvent:Name.GetNSString() parameters:GetNSDictionary(Parameters)];
 #elif PLATFORM_ANDROID
+    if (bIsEventBatchingEnabled.load(std::memory_order_relaxed))
+    {
+        GetEventBatch().Add(Name, Parameters);
+        return;
+    }
+
     FString SerializedParameters = AppLovinMAXUtils::SerializeMap(Parameters);
     GetAndroidPlugin()->TrackEvent(Name, SerializedParameters);
 #endif
 }
 
+void UAppLovinMAX::SetEventBatchingEnabled(bool bEnabled, int32 MaxBatchSize, float MaxBatchDelay)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(SetEventBatchingEnabled, bEnabled, MaxBatchSize, MaxBatchDelay);
+    MAX_TRACE_BRIDGE_CALL(SetEventBatchingEnabled);
+
+#if PLATFORM_ANDROID
+    GetEventBatch().SetLimits(MaxBatchSize, MaxBatchDelay);
+    bIsEventBatchingEnabled.store(bEnabled, std::memory_order_relaxed);
+
+    if (!bEnabled)
+    {
+        GetEventBatch().Flush();
+    }
+#endif
+}
+
+void UAppLovinMAX::FlushTrackedEvents()
+{
+    MAX_DEFER_UNTIL_INITIALIZED(FlushTrackedEvents);
+    MAX_TRACE_BRIDGE_CALL(FlushTrackedEvents);
+
+#if PLATFORM_ANDROID
+    GetEventBatch().Flush();
+#endif
+}
+
+// MARK: - Ad Units
+
+FAdUnitHandle UAppLovinMAX::RegisterAdUnit(const FString &AdUnitIdentifier)
+{
+    UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("register ad unit"));
+    return AppLovinMAXAdUnits::Register(AdUnitIdentifier);
+}
+
+// MARK: - Ad View Commands
+
+#if PLATFORM_ANDROID
+namespace
+{
+    std::atomic<bool> bIsAdViewCommandBufferingEnabled{false};
+} // namespace
+#endif
+
+void UAppLovinMAX::SetAdViewCommandBufferingEnabled(bool bEnabled)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(SetAdViewCommandBufferingEnabled, bEnabled);
+    MAX_TRACE_BRIDGE_CALL(SetAdViewCommandBufferingEnabled);
+
+#if PLATFORM_ANDROID
+    bIsAdViewCommandBufferingEnabled.store(bEnabled, std::memory_order_relaxed);
+
+    if (!bEnabled)
+    {
+        GetAdViewCommandBuffer().Submit();
+    }
+#endif
+}
+
+void UAppLovinMAX::SubmitAdViewCommands()
+{
+    MAX_DEFER_UNTIL_INITIALIZED(SubmitAdViewCommands);
+    MAX_TRACE_BRIDGE_CALL(SubmitAdViewCommands);
+
+#if PLATFORM_ANDROID
+    GetAdViewCommandBuffer().Submit();
+#endif
+}
+
 // MARK: - Banners
 
 void UAppLovinMAX::CreateBanner(const FString &AdUnitIdentifier, EAdViewPosition BannerPosition)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("create banner"));
-    const FString BannerPositionString = GetAdViewPositionString(BannerPosition);
+    UAppLovinMAX::CreateBanner(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier, BannerPosition);
+}
+
+void UAppLovinMAX::CreateBanner(FAdUnitHandle AdUnit, EAdViewPosition BannerPosition)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("create banner"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::CreateBanner(AdUnit, *RegisteredIdentifier, BannerPosition);
+}
+
+void UAppLovinMAX::CreateBanner(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, EAdViewPosition BannerPosition)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(CreateBanner, AdUnit, AdUnitIdentifier, BannerPosition);
+    MAX_TRACE_BRIDGE_CALL(CreateBanner);
+
+    UAppLovinMAX::RegisterNativeAdUnitHandle(AdUnit, AdUnitIdentifier);
+    AppLovinMAXAdInventory::RecordAdViewCreated(AdUnitIdentifier, false, BannerPosition);
 #if PLATFORM_IOS
-    [GetIOSPlugin() createBannerWithAdUnitIdentifier:AdUnitIdentifier.GetNSString() atPosition:BannerPositionString.GetNSString()];
+    [GetIOSPlugin() createBannerWithAdUnitIdentifier:AdUnitIdentifier.GetNSString() atPosition:(int)BannerPosition];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->CreateBanner(AdUnitIdentifier, BannerPositionString);
+    // Earlier buffered operations must reach the native plugin before the ad view is created or destroyed
+    GetAdViewCommandBuffer().Submit();
+    GetAndroidPlugin()->CreateBanner(AdUnitIdentifier, (int32)BannerPosition);
+#else
+    GetMockPlugin()->CreateBanner(AdUnitIdentifier);
 #endif
 }
 
 void UAppLovinMAX::SetBannerBackgroundColor(const FString &AdUnitIdentifier, const FColor &Color)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetBannerBackgroundColor, AdUnitIdentifier, Color);
+    MAX_TRACE_BRIDGE_CALL(SetBannerBackgroundColor);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("set banner background color"));
+    AppLovinMAXAdInventory::RecordBannerBackgroundColor(AdUnitIdentifier, Color);
     FString HexColorCode = AppLovinMAXUtils::ParseColor(Color);
 #if PLATFORM_IOS
     [GetIOSPlugin() setBannerBackgroundColorForAdUnitIdentifier:AdUnitIdentifier.GetNSString() hexColorCode:HexColorCode.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->SetBannerBackgroundColor(AdUnitIdentifier, HexColorCode);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetBackgroundColor(AdUnitIdentifier, false, HexColorCode);
+    }
+    else
+    {
+        GetAndroidPlugin()->SetBannerBackgroundColor(AdUnitIdentifier, HexColorCode);
+    }
 #endif
 }
 
 void UAppLovinMAX::SetBannerPlacement(const FString &AdUnitIdentifier, const FString &Placement)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetBannerPlacement, AdUnitIdentifier, Placement);
+    MAX_TRACE_BRIDGE_CALL(SetBannerPlacement);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("set banner placement"));
+    AppLovinMAXAdInventory::RecordAdViewPlacement(AdUnitIdentifier, Placement);
 #if PLATFORM_IOS
     [GetIOSPlugin() setBannerPlacement:Placement.GetNSString() forAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->SetBannerPlacement(AdUnitIdentifier, Placement);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetPlacement(AdUnitIdentifier, false, Placement);
+    }
+    else
+    {
+        GetAndroidPlugin()->SetBannerPlacement(AdUnitIdentifier, Placement);
+    }
 #endif
 }
 
 void UAppLovinMAX::SetBannerExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetBannerExtraParameter, AdUnitIdentifier, Key, Value);
+    MAX_TRACE_BRIDGE_CALL(SetBannerExtraParameter);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("set banner extra parameter"));
+    AppLovinMAXAdInventory::RecordAdViewExtraParameter(AdUnitIdentifier, Key, Value);
 #if PLATFORM_IOS
     [GetIOSPlugin() setBannerExtraParameterForAdUnitIdentifier:AdUnitIdentifier.GetNSString() key:Key.GetNSString() value:Value.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->SetBannerExtraParameter(AdUnitIdentifier, Key, Value);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetExtraParameter(AdUnitIdentifier, false, Key, Value);
+    }
+    else
+    {
+        GetAndroidPlugin()->SetBannerExtraParameter(AdUnitIdentifier, Key, Value);
+    }
 #endif
 }
 
 void UAppLovinMAX::UpdateBannerPosition(const FString &AdUnitIdentifier, EAdViewPosition BannerPosition)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(UpdateBannerPosition, AdUnitIdentifier, BannerPosition);
+    MAX_TRACE_BRIDGE_CALL(UpdateBannerPosition);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("update banner position"));
-    const FString BannerPositionString = GetAdViewPositionString(BannerPosition);
+    AppLovinMAXAdInventory::RecordAdViewPosition(AdUnitIdentifier, BannerPosition);
 #if PLATFORM_IOS
-    [GetIOSPlugin() updateBannerPosition:BannerPositionString.GetNSString() forAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
+    [GetIOSPlugin() updateBannerPosition:(int)BannerPosition forAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->UpdateBannerPosition(AdUnitIdentifier, BannerPositionString);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetPosition(AdUnitIdentifier, false, (int32)BannerPosition);
+    }
+    else
+    {
+        GetAndroidPlugin()->UpdateBannerPosition(AdUnitIdentifier, (int32)BannerPosition);
+    }
 #endif
 }
 
 void UAppLovinMAX::ShowBanner(const FString &AdUnitIdentifier)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("show banner"));
+    UAppLovinMAX::ShowBanner(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier);
+}
+
+void UAppLovinMAX::ShowBanner(FAdUnitHandle AdUnit)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("show banner"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::ShowBanner(AdUnit, *RegisteredIdentifier);
+}
+
+void UAppLovinMAX::ShowBanner(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(ShowBanner, AdUnit, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(ShowBanner);
+
+    AppLovinMAXAdInventory::RecordAdViewVisibility(AdUnitIdentifier, true);
 #if PLATFORM_IOS
     [GetIOSPlugin() showBannerWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->ShowBanner(AdUnitIdentifier);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetVisible(AdUnitIdentifier, false, true);
+    }
+    else
+    {
+        GetAndroidPlugin()->ShowBanner(AdUnitIdentifier);
+    }
 #endif
 }
 
 void UAppLovinMAX::HideBanner(const FString &AdUnitIdentifier)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("hide banner"));
+    UAppLovinMAX::HideBanner(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier);
+}
+
+void UAppLovinMAX::HideBanner(FAdUnitHandle AdUnit)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("hide banner"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::HideBanner(AdUnit, *RegisteredIdentifier);
+}
+
+void UAppLovinMAX::HideBanner(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(HideBanner, AdUnit, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(HideBanner);
+
+    AppLovinMAXAdInventory::RecordAdViewVisibility(AdUnitIdentifier, false);
 #if PLATFORM_IOS
     [GetIOSPlugin() hideBannerWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->HideBanner(AdUnitIdentifier);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetVisible(AdUnitIdentifier, false, false);
+    }
+    else
+    {
+        GetAndroidPlugin()->HideBanner(AdUnitIdentifier);
+    }
 #endif
 }
 
 void UAppLovinMAX::DestroyBanner(const FString &AdUnitIdentifier)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("destroy banner"));
+    UAppLovinMAX::DestroyBanner(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier);
+}
+
+void UAppLovinMAX::DestroyBanner(FAdUnitHandle AdUnit)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("destroy banner"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::DestroyBanner(AdUnit, *RegisteredIdentifier);
+}
+
+void UAppLovinMAX::DestroyBanner(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(DestroyBanner, AdUnit, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(DestroyBanner);
+
+    AppLovinMAXAdInventory::RecordAdViewDestroyed(AdUnitIdentifier);
 #if PLATFORM_IOS
     [GetIOSPlugin() destroyBannerWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
+    // Earlier buffered operations must reach the native plugin before the ad view is created or destroyed
+    GetAdViewCommandBuffer().Submit();
     GetAndroidPlugin()->DestroyBanner(AdUnitIdentifier);
+#else
+    GetMockPlugin()->DestroyBanner(AdUnitIdentifier);
 #endif
 }
 
@@ -343,97 +732,304 @@ void UAppLovinMAX::DestroyBanner(const FString &AdUnitIdentifier)
 void UAppLovinMAX::CreateMRec(const FString &AdUnitIdentifier, EAdViewPosition MRecPosition)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("create MREC"));
-    const FString MRecPositionString = GetAdViewPositionString(MRecPosition);
+    UAppLovinMAX::CreateMRec(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier, MRecPosition);
+}
+
+void UAppLovinMAX::CreateMRec(FAdUnitHandle AdUnit, EAdViewPosition MRecPosition)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("create MREC"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::CreateMRec(AdUnit, *RegisteredIdentifier, MRecPosition);
+}
+
+void UAppLovinMAX::CreateMRec(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, EAdViewPosition MRecPosition)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(CreateMRec, AdUnit, AdUnitIdentifier, MRecPosition);
+    MAX_TRACE_BRIDGE_CALL(CreateMRec);
+
+    UAppLovinMAX::RegisterNativeAdUnitHandle(AdUnit, AdUnitIdentifier);
+    AppLovinMAXAdInventory::RecordAdViewCreated(AdUnitIdentifier, true, MRecPosition);
 #if PLATFORM_IOS
-    [GetIOSPlugin() createMRecWithAdUnitIdentifier:AdUnitIdentifier.GetNSString() atPosition:MRecPositionString.GetNSString()];
+    [GetIOSPlugin() createMRecWithAdUnitIdentifier:AdUnitIdentifier.GetNSString() atPosition:(int)MRecPosition];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->CreateMRec(AdUnitIdentifier, MRecPositionString);
+    // Earlier buffered operations must reach the native plugin before the ad view is created or destroyed
+    GetAdViewCommandBuffer().Submit();
+    GetAndroidPlugin()->CreateMRec(AdUnitIdentifier, (int32)MRecPosition);
+#else
+    GetMockPlugin()->CreateMRec(AdUnitIdentifier);
 #endif
 }
 
 void UAppLovinMAX::SetMRecPlacement(const FString &AdUnitIdentifier, const FString &Placement)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetMRecPlacement, AdUnitIdentifier, Placement);
+    MAX_TRACE_BRIDGE_CALL(SetMRecPlacement);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("set MREC placement"));
+    AppLovinMAXAdInventory::RecordAdViewPlacement(AdUnitIdentifier, Placement);
 #if PLATFORM_IOS
     [GetIOSPlugin() setMRecPlacement:Placement.GetNSString() forAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->SetMRecPlacement(AdUnitIdentifier, Placement);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetPlacement(AdUnitIdentifier, true, Placement);
+    }
+    else
+    {
+        GetAndroidPlugin()->SetMRecPlacement(AdUnitIdentifier, Placement);
+    }
 #endif
 }
 
 void UAppLovinMAX::SetMRecExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetMRecExtraParameter, AdUnitIdentifier, Key, Value);
+    MAX_TRACE_BRIDGE_CALL(SetMRecExtraParameter);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("set MREC extra parameter"));
+    AppLovinMAXAdInventory::RecordAdViewExtraParameter(AdUnitIdentifier, Key, Value);
 #if PLATFORM_IOS
     [GetIOSPlugin() setMRecExtraParameterForAdUnitIdentifier:AdUnitIdentifier.GetNSString() key:Key.GetNSString() value:Value.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->SetMRecExtraParameter(AdUnitIdentifier, Key, Value);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetExtraParameter(AdUnitIdentifier, true, Key, Value);
+    }
+    else
+    {
+        GetAndroidPlugin()->SetMRecExtraParameter(AdUnitIdentifier, Key, Value);
+    }
 #endif
 }
 
 void UAppLovinMAX::UpdateMRecPosition(const FString &AdUnitIdentifier, EAdViewPosition MRecPosition)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(UpdateMRecPosition, AdUnitIdentifier, MRecPosition);
+    MAX_TRACE_BRIDGE_CALL(UpdateMRecPosition);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("update MREC position"));
-    const FString MRecPositionString = GetAdViewPositionString(MRecPosition);
+    AppLovinMAXAdInventory::RecordAdViewPosition(AdUnitIdentifier, MRecPosition);
 #if PLATFORM_IOS
-    [GetIOSPlugin() updateMRecPosition:MRecPositionString.GetNSString() forAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
+    [GetIOSPlugin() updateMRecPosition:(int)MRecPosition forAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->UpdateMRecPosition(AdUnitIdentifier, MRecPositionString);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetPosition(AdUnitIdentifier, true, (int32)MRecPosition);
+    }
+    else
+    {
+        GetAndroidPlugin()->UpdateMRecPosition(AdUnitIdentifier, (int32)MRecPosition);
+    }
 #endif
 }
 
 void UAppLovinMAX::ShowMRec(const FString &AdUnitIdentifier)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("show MREC"));
+    UAppLovinMAX::ShowMRec(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier);
+}
+
+void UAppLovinMAX::ShowMRec(FAdUnitHandle AdUnit)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("show MREC"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::ShowMRec(AdUnit, *RegisteredIdentifier);
+}
+
+void UAppLovinMAX::ShowMRec(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(ShowMRec, AdUnit, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(ShowMRec);
+
+    AppLovinMAXAdInventory::RecordAdViewVisibility(AdUnitIdentifier, true);
 #if PLATFORM_IOS
     [GetIOSPlugin() showMRecWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->ShowMRec(AdUnitIdentifier);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetVisible(AdUnitIdentifier, true, true);
+    }
+    else
+    {
+        GetAndroidPlugin()->ShowMRec(AdUnitIdentifier);
+    }
 #endif
 }
 
 void UAppLovinMAX::HideMRec(const FString &AdUnitIdentifier)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("hide MREC"));
+    UAppLovinMAX::HideMRec(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier);
+}
+
+void UAppLovinMAX::HideMRec(FAdUnitHandle AdUnit)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("hide MREC"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::HideMRec(AdUnit, *RegisteredIdentifier);
+}
+
+void UAppLovinMAX::HideMRec(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(HideMRec, AdUnit, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(HideMRec);
+
+    AppLovinMAXAdInventory::RecordAdViewVisibility(AdUnitIdentifier, false);
 #if PLATFORM_IOS
     [GetIOSPlugin() hideMRecWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    GetAndroidPlugin()->HideMRec(AdUnitIdentifier);
+    if (bIsAdViewCommandBufferingEnabled.load(std::memory_order_relaxed))
+    {
+        GetAdViewCommandBuffer().SetVisible(AdUnitIdentifier, true, false);
+    }
+    else
+    {
+        GetAndroidPlugin()->HideMRec(AdUnitIdentifier);
+    }
 #endif
 }
 
 void UAppLovinMAX::DestroyMRec(const FString &AdUnitIdentifier)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("destroy MREC"));
+    UAppLovinMAX::DestroyMRec(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier);
+}
+
+void UAppLovinMAX::DestroyMRec(FAdUnitHandle AdUnit)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("destroy MREC"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::DestroyMRec(AdUnit, *RegisteredIdentifier);
+}
+
+void UAppLovinMAX::DestroyMRec(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(DestroyMRec, AdUnit, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(DestroyMRec);
+
+    AppLovinMAXAdInventory::RecordAdViewDestroyed(AdUnitIdentifier);
 #if PLATFORM_IOS
     [GetIOSPlugin() destroyMRecWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
+    // Earlier buffered operations must reach the native plugin before the ad view is created or destroyed
+    GetAdViewCommandBuffer().Submit();
     GetAndroidPlugin()->DestroyMRec(AdUnitIdentifier);
+#else
+    GetMockPlugin()->DestroyMRec(AdUnitIdentifier);
 #endif
 }
 
 // MARK: - Interstitials
 
+namespace
+{
+    FAdError MakeInvalidAdUnitHandleError(FAdUnitHandle AdUnit)
+    {
+        FAdError AdError;
+        AdError.Code = -1;
+        AdError.Message = FString::Printf(TEXT("Invalid MAX Ads Ad Unit handle %d"), AdUnit.Index);
+        return AdError;
+    }
+
+    // Sets the future to the first of the given events for the ad unit
+    TFuture<FAdResult> ListenForAdResult(FAdUnitHandle AdUnit, EAppLovinMAXEvent SuccessEvent, EAppLovinMAXEvent FailureEvent)
+    {
+        TSharedRef<TPromise<FAdResult>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FAdResult>, ESPMode::ThreadSafe>();
+        TFuture<FAdResult> Future = Promise->GetFuture();
+
+        const uint32 ListenerId = AppLovinMAXAdUnitListeners::Add(AdUnit, [Promise, SuccessEvent, FailureEvent](EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)
+        {
+            if (Event == SuccessEvent)
+            {
+                Promise->SetValue(FAdResult(TInPlaceType<FAdInfo>(), AdInfo));
+            }
+            else if (Event == FailureEvent)
+            {
+                Promise->SetValue(FAdResult(TInPlaceType<FAdError>(), AdError));
+            }
+            else
+            {
+                return false;
+            }
+            return true;
+        });
+
+        if (ListenerId == 0)
+        {
+            Promise->SetValue(FAdResult(TInPlaceType<FAdError>(), MakeInvalidAdUnitHandleError(AdUnit)));
+        }
+        return Future;
+    }
+} // namespace
+
 void UAppLovinMAX::LoadInterstitial(const FString &AdUnitIdentifier)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("load interstitial"));
-#if PLATFORM_IOS
-    [GetIOSPlugin() loadInterstitialWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
-#elif PLATFORM_ANDROID
-    GetAndroidPlugin()->LoadInterstitial(AdUnitIdentifier);
-#endif
+    UAppLovinMAX::LoadInterstitial(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier);
 }
 
-bool UAppLovinMAX::IsInterstitialReady(const FString &AdUnitIdentifier)
+void UAppLovinMAX::LoadInterstitial(FAdUnitHandle AdUnit)
 {
-    UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("check interstitial loaded"));
-#if PLATFORM_IOS
-    return [GetIOSPlugin() isInterstitialReadyWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("load interstitial"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::LoadInterstitial(AdUnit, *RegisteredIdentifier);
+}
+
+void UAppLovinMAX::LoadInterstitial(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(LoadInterstitial, AdUnit, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(LoadInterstitial);
+
+    UAppLovinMAX::RegisterNativeAdUnitHandle(AdUnit, AdUnitIdentifier);
+    AppLovinMAXAdInventory::RecordFullscreenAdLoad(AdUnitIdentifier, false);
+#if PLATFORM_IOS
+    [GetIOSPlugin() loadInterstitialWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    return GetAndroidPlugin()->IsInterstitialReady(AdUnitIdentifier);
+    GetAndroidPlugin()->LoadInterstitial(AdUnitIdentifier);
 #else
-    return false;
+    GetMockPlugin()->LoadInterstitial(AdUnitIdentifier);
+#endif
+}
+
+bool UAppLovinMAX::IsInterstitialReady(const FString &AdUnitIdentifier, bool bVerifyWithNative)
+{
+    UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("check interstitial loaded"));
+    return UAppLovinMAX::IsInterstitialReady(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier, bVerifyWithNative);
+}
+
+bool UAppLovinMAX::IsInterstitialReady(FAdUnitHandle AdUnit, bool bVerifyWithNative)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("check interstitial loaded"));
+    if (RegisteredIdentifier == nullptr) return false;
+
+    return UAppLovinMAX::IsInterstitialReady(AdUnit, *RegisteredIdentifier, bVerifyWithNative);
+}
+
+bool UAppLovinMAX::IsInterstitialReady(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, bool bVerifyWithNative)
+{
+    bool bIsReady = false;
+    if (!bVerifyWithNative && AppLovinMAXAdReadiness::TryGetReady(AdUnit, bIsReady))
+    {
+        return bIsReady;
+    }
+
+    // Only reached when the readiness table cannot answer
+    MAX_TRACE_BRIDGE_CALL(IsInterstitialReady);
+
+#if PLATFORM_IOS
+    bIsReady = [GetIOSPlugin() isInterstitialReadyWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
+#elif PLATFORM_ANDROID
+    bIsReady = GetAndroidPlugin()->IsInterstitialReady(AdUnitIdentifier);
+#else
+    bIsReady = GetMockPlugin()->IsInterstitialReady(AdUnitIdentifier);
 #endif
+    AppLovinMAXAdReadiness::SetReady(AdUnit, bIsReady);
+    return bIsReady;
 }
 
 void UAppLovinMAX::ShowInterstitial(const FString &AdUnitIdentifier)
@@ -445,15 +1041,36 @@ void UAppLovinMAX::ShowInterstitial(const FString &AdUnitIdentifier)
 void UAppLovinMAX::ShowInterstitial(const FString &AdUnitIdentifier, const FString &Placement)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("show interstitial"));
+    UAppLovinMAX::ShowInterstitial(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier, Placement);
+}
+
+void UAppLovinMAX::ShowInterstitial(FAdUnitHandle AdUnit, const FString &Placement)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("show interstitial"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::ShowInterstitial(AdUnit, *RegisteredIdentifier, Placement);
+}
+
+void UAppLovinMAX::ShowInterstitial(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, const FString &Placement)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(ShowInterstitial, AdUnit, AdUnitIdentifier, Placement);
+    MAX_TRACE_BRIDGE_CALL(ShowInterstitial);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() showInterstitialWithAdUnitIdentifier:AdUnitIdentifier.GetNSString() placement:Placement.GetNSString()];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->ShowInterstitial(AdUnitIdentifier, Placement);
+#else
+    GetMockPlugin()->ShowInterstitial(AdUnitIdentifier, Placement);
 #endif
 }
 
 void UAppLovinMAX::SetInterstitialExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetInterstitialExtraParameter, AdUnitIdentifier, Key, Value);
+    MAX_TRACE_BRIDGE_CALL(SetInterstitialExtraParameter);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("set interstitial extra parameter"));
 #if PLATFORM_IOS
     [GetIOSPlugin() setInterstitialExtraParameterForAdUnitIdentifier:AdUnitIdentifier.GetNSString() key:Key.GetNSString() value:Value.GetNSString()];
@@ -462,28 +1079,141 @@ void UAppLovinMAX::SetInterstitialExtraParameter(const FString &AdUnitIdentifier
 #endif
 }
 
+void UAppLovinMAX::DestroyInterstitial(const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(DestroyInterstitial, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(DestroyInterstitial);
+
+    UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("destroy interstitial"));
+    AppLovinMAXAdReadiness::SetReady(AppLovinMAXAdUnits::Register(AdUnitIdentifier), false);
+#if PLATFORM_IOS
+    [GetIOSPlugin() destroyInterstitialWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
+#elif PLATFORM_ANDROID
+    GetAndroidPlugin()->DestroyInterstitial(AdUnitIdentifier);
+#else
+    GetMockPlugin()->DestroyInterstitial(AdUnitIdentifier);
+#endif
+}
+
+// The listener is added before the call so that the result cannot arrive first on the native plugin's thread
+TFuture<FAdResult> UAppLovinMAX::LoadInterstitialAsync(FAdUnitHandle AdUnit)
+{
+    TFuture<FAdResult> Future = ListenForAdResult(AdUnit, EAppLovinMAXEvent::InterstitialAdLoaded, EAppLovinMAXEvent::InterstitialAdLoadFailed);
+    UAppLovinMAX::LoadInterstitial(AdUnit);
+    return Future;
+}
+
+TFuture<FAdResult> UAppLovinMAX::ShowInterstitialAsync(FAdUnitHandle AdUnit, const FString &Placement)
+{
+    TFuture<FAdResult> Future = ListenForAdResult(AdUnit, EAppLovinMAXEvent::InterstitialAdHidden, EAppLovinMAXEvent::InterstitialAdDisplayFailed);
+    UAppLovinMAX::ShowInterstitial(AdUnit, Placement);
+    return Future;
+}
+
 // MARK: - Rewarded
 
+namespace
+{
+    // Sets the future once the rewarded ad is hidden or failed to display, with the reward earned while it was displayed
+    TFuture<FRewardedAdResult> ListenForRewardedAdResult(FAdUnitHandle AdUnit)
+    {
+        TSharedRef<TPromise<FRewardedAdResult>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FRewardedAdResult>, ESPMode::ThreadSafe>();
+        TFuture<FRewardedAdResult> Future = Promise->GetFuture();
+
+        // The events of an ad unit are dispatched one at a time, so the earned reward needs no lock
+        const uint32 ListenerId = AppLovinMAXAdUnitListeners::Add(AdUnit, [Promise, EarnedReward = FAdReward()](EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward) mutable
+        {
+            switch (Event)
+            {
+                case EAppLovinMAXEvent::RewardedAdReceivedReward:
+                    EarnedReward = Reward;
+                    return false;
+
+                case EAppLovinMAXEvent::RewardedAdHidden:
+                    Promise->SetValue(FRewardedAdResult{FAdResult(TInPlaceType<FAdInfo>(), AdInfo), EarnedReward});
+                    return true;
+
+                case EAppLovinMAXEvent::RewardedAdDisplayFailed:
+                    Promise->SetValue(FRewardedAdResult{FAdResult(TInPlaceType<FAdError>(), AdError), FAdReward()});
+                    return true;
+
+                default:
+                    return false;
+            }
+        });
+
+        if (ListenerId == 0)
+        {
+            Promise->SetValue(FRewardedAdResult{FAdResult(TInPlaceType<FAdError>(), MakeInvalidAdUnitHandleError(AdUnit)), FAdReward()});
+        }
+        return Future;
+    }
+} // namespace
+
 void UAppLovinMAX::LoadRewardedAd(const FString &AdUnitIdentifier)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("load rewarded ad"));
+    UAppLovinMAX::LoadRewardedAd(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier);
+}
+
+void UAppLovinMAX::LoadRewardedAd(FAdUnitHandle AdUnit)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("load rewarded ad"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::LoadRewardedAd(AdUnit, *RegisteredIdentifier);
+}
+
+void UAppLovinMAX::LoadRewardedAd(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(LoadRewardedAd, AdUnit, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(LoadRewardedAd);
+
+    UAppLovinMAX::RegisterNativeAdUnitHandle(AdUnit, AdUnitIdentifier);
+    AppLovinMAXAdInventory::RecordFullscreenAdLoad(AdUnitIdentifier, true);
 #if PLATFORM_IOS
     [GetIOSPlugin() loadRewardedAdWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->LoadRewardedAd(AdUnitIdentifier);
+#else
+    GetMockPlugin()->LoadRewardedAd(AdUnitIdentifier);
 #endif
 }
 
-bool UAppLovinMAX::IsRewardedAdReady(const FString &AdUnitIdentifier)
+bool UAppLovinMAX::IsRewardedAdReady(const FString &AdUnitIdentifier, bool bVerifyWithNative)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("check rewarded ad loaded"));
+    return UAppLovinMAX::IsRewardedAdReady(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier, bVerifyWithNative);
+}
+
+bool UAppLovinMAX::IsRewardedAdReady(FAdUnitHandle AdUnit, bool bVerifyWithNative)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("check rewarded ad loaded"));
+    if (RegisteredIdentifier == nullptr) return false;
+
+    return UAppLovinMAX::IsRewardedAdReady(AdUnit, *RegisteredIdentifier, bVerifyWithNative);
+}
+
+bool UAppLovinMAX::IsRewardedAdReady(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, bool bVerifyWithNative)
+{
+    bool bIsReady = false;
+    if (!bVerifyWithNative && AppLovinMAXAdReadiness::TryGetReady(AdUnit, bIsReady))
+    {
+        return bIsReady;
+    }
+
+    // Only reached when the readiness table cannot answer
+    MAX_TRACE_BRIDGE_CALL(IsRewardedAdReady);
+
 #if PLATFORM_IOS
-    return [GetIOSPlugin() isRewardedAdReadyWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
+    bIsReady = [GetIOSPlugin() isRewardedAdReadyWithAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
 #elif PLATFORM_ANDROID
-    return GetAndroidPlugin()->IsRewardedAdReady(AdUnitIdentifier);
+    bIsReady = GetAndroidPlugin()->IsRewardedAdReady(AdUnitIdentifier);
 #else
-    return false;
+    bIsReady = GetMockPlugin()->IsRewardedAdReady(AdUnitIdentifier);
 #endif
+    AppLovinMAXAdReadiness::SetReady(AdUnit, bIsReady);
+    return bIsReady;
 }
 
 void UAppLovinMAX::ShowRewardedAd(const FString &AdUnitIdentifier)
@@ -495,15 +1225,36 @@ void UAppLovinMAX::ShowRewardedAd(const FString &AdUnitIdentifier)
 void UAppLovinMAX::ShowRewardedAd(const FString &AdUnitIdentifier, const FString &Placement)
 {
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("show rewarded ad"));
+    UAppLovinMAX::ShowRewardedAd(AppLovinMAXAdUnits::Register(AdUnitIdentifier), AdUnitIdentifier, Placement);
+}
+
+void UAppLovinMAX::ShowRewardedAd(FAdUnitHandle AdUnit, const FString &Placement)
+{
+    const FString *RegisteredIdentifier = UAppLovinMAX::ResolveAdUnitHandle(AdUnit, TEXT("show rewarded ad"));
+    if (RegisteredIdentifier == nullptr) return;
+
+    UAppLovinMAX::ShowRewardedAd(AdUnit, *RegisteredIdentifier, Placement);
+}
+
+void UAppLovinMAX::ShowRewardedAd(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, const FString &Placement)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(ShowRewardedAd, AdUnit, AdUnitIdentifier, Placement);
+    MAX_TRACE_BRIDGE_CALL(ShowRewardedAd);
+
 #if PLATFORM_IOS
     [GetIOSPlugin() showRewardedAdWithAdUnitIdentifier:AdUnitIdentifier.GetNSString() placement:Placement.GetNSString()];
 #elif PLATFORM_ANDROID
     GetAndroidPlugin()->ShowRewardedAd(AdUnitIdentifier, Placement);
+#else
+    GetMockPlugin()->ShowRewardedAd(AdUnitIdentifier, Placement);
 #endif
 }
 
 void UAppLovinMAX::SetRewardedAdExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
 {
+    MAX_DEFER_UNTIL_INITIALIZED(SetRewardedAdExtraParameter, AdUnitIdentifier, Key, Value);
+    MAX_TRACE_BRIDGE_CALL(SetRewardedAdExtraParameter);
+
     UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("set rewarded ad extra parameter"));
 #if PLATFORM_IOS
     [GetIOSPlugin() setRewardedAdExtraParameterForAdUnitIdentifier:AdUnitIdentifier.GetNSString() key:Key.GetNSString() value:Value.GetNSString()];
@@ -512,6 +1263,120 @@ void UAppLovinMAX::SetRewardedAdExtraParameter(const FString &AdUnitIdentifier,
 #endif
 }
 
+void UAppLovinMAX::DestroyRewardedAd(const FString &AdUnitIdentifier)
+{
+    MAX_DEFER_UNTIL_INITIALIZED(DestroyRewardedAd, AdUnitIdentifier);
+    MAX_TRACE_BRIDGE_CALL(DestroyRewardedAd);
+
+    UAppLovinMAX::ValidateAdUnitIdentifier(AdUnitIdentifier, TEXT("destroy rewarded ad"));
+    AppLovinMAXAdReadiness::SetReady(AppLovinMAXAdUnits::Register(AdUnitIdentifier), false);
+#if PLATFORM_IOS
+    // Rewarded ads on iOS are shared instances owned by the SDK, so a loaded ad cannot be released and is kept until shown
+#elif PLATFORM_ANDROID
+    GetAndroidPlugin()->DestroyRewardedAd(AdUnitIdentifier);
+#else
+    GetMockPlugin()->DestroyRewardedAd(AdUnitIdentifier);
+#endif
+}
+
+TFuture<FAdResult> UAppLovinMAX::LoadRewardedAdAsync(FAdUnitHandle AdUnit)
+{
+    TFuture<FAdResult> Future = ListenForAdResult(AdUnit, EAppLovinMAXEvent::RewardedAdLoaded, EAppLovinMAXEvent::RewardedAdLoadFailed);
+    UAppLovinMAX::LoadRewardedAd(AdUnit);
+    return Future;
+}
+
+TFuture<FRewardedAdResult> UAppLovinMAX::ShowRewardedAdAsync(FAdUnitHandle AdUnit, const FString &Placement)
+{
+    TFuture<FRewardedAdResult> Future = ListenForRewardedAdResult(AdUnit);
+    UAppLovinMAX::ShowRewardedAd(AdUnit, Placement);
+    return Future;
+}
+
+// MARK: - Ad Inventory
+
+void UAppLovinMAX::SetAdInventoryManagementEnabled(bool bEnabled, bool bEvictLoadedAds, float RestoreDelay)
+{
+    AppLovinMAXAdInventory::SetEnabled(bEnabled, bEvictLoadedAds, RestoreDelay);
+}
+
+void UAppLovinMAX::EvictAdInventory()
+{
+    AppLovinMAXAdInventory::HandleMemoryWarning();
+}
+
+TArray<FAdInventoryEviction> UAppLovinMAX::GetAdInventoryEvictions()
+{
+    return AppLovinMAXAdInventory::GetEvictions();
+}
+
+// MARK: - Fullscreen Ad Throttling
+
+void UAppLovinMAX::SetFullscreenAdThrottlingEnabled(bool bEnabled, const FAppLovinMAXThrottleSettings &Settings)
+{
+    AppLovinMAXFullscreenThrottle::SetEnabled(bEnabled, Settings);
+}
+
+bool UAppLovinMAX::IsFullscreenAdThrottling()
+{
+    return AppLovinMAXFullscreenThrottle::IsThrottling();
+}
+
+// MARK: - Revenue
+
+TArray<FAdRevenueSummary> UAppLovinMAX::GetRevenueByAdUnit()
+{
+    return AppLovinMAXRevenue::GetSummariesByAdUnit();
+}
+
+TArray<FAdRevenueSummary> UAppLovinMAX::GetRevenueByNetwork()
+{
+    return AppLovinMAXRevenue::GetSummariesByNetwork();
+}
+
+TArray<FAdRevenueSummary> UAppLovinMAX::GetRevenueByPlacement()
+{
+    return AppLovinMAXRevenue::GetSummariesByPlacement();
+}
+
+void UAppLovinMAX::ResetRevenue()
+{
+    AppLovinMAXRevenue::Reset();
+}
+
+// MARK: - Ad Errors
+
+FAdWaterfallInfo UAppLovinMAX::GetAdErrorWaterfall(const FAdError &AdError)
+{
+    return AdError.GetWaterfall();
+}
+
+FString UAppLovinMAX::GetAdErrorWaterfallString(const FAdError &AdError)
+{
+    return AdError.GetWaterfallString();
+}
+
+// MARK: - Event Recording
+
+bool UAppLovinMAX::StartEventRecording(const FString &FilePath)
+{
+    return AppLovinMAXEventRecorder::StartRecording(FilePath);
+}
+
+void UAppLovinMAX::StopEventRecording()
+{
+    AppLovinMAXEventRecorder::StopRecording();
+}
+
+// MARK: - Mock Backend
+
+void UAppLovinMAX::SetMockSettings(const FAppLovinMAXMockSettings &Settings)
+{
+#if !PLATFORM_IOS && !PLATFORM_ANDROID
+    GetMockPlugin()->SetSettings(Settings);
+#endif
+}
+
 // MARK: - Delegates
 
 // Static Delegate Initialization
@@ -545,231 +1410,343 @@ UAppLovinMAX::FOnRewardedAdClickedDelegate UAppLovinMAX::OnRewardedAdClickedDele
 UAppLovinMAX::FOnRewardedAdRevenuePaidDelegate UAppLovinMAX::OnRewardedAdRevenuePaidDelegate;
 UAppLovinMAX::FOnRewardedAdReceivedRewardDelegate UAppLovinMAX::OnRewardedAdReceivedRewardDelegate;
 
-void ForwardEvent(const FString &Name, const FString &Body)
+// MARK: - Delegate Threads
+
+namespace
 {
-    if (Name == TEXT("OnSdkInitializedEvent"))
-    {
-        FSdkConfiguration SdkConfiguration;
-        FJsonObjectConverter::JsonObjectStringToUStruct<FSdkConfiguration>(Body, &SdkConfiguration, 0, 0);
-        UAppLovinMAX::OnSdkInitializedDelegate.Broadcast(SdkConfiguration);
-        UAppLovinMAXDelegate::BroadcastSdkInitializedEvent(SdkConfiguration);
-    }
-    else if (Name == TEXT("OnCmpCompletedEvent"))
-    {
-        FCmpError CmpError;
-        FJsonObjectConverter::JsonObjectStringToUStruct<FCmpError>(Body, &CmpError, 0, 0);
-        
-        UAppLovinMAX::OnCmpCompletedDelegate.Broadcast(CmpError);
-        UAppLovinMAXDelegate::BroadcastCmpCompletedEvent(CmpError);
-    }
-    else // Ad Events
-    {
-        FAdInfo AdInfo;
-        FJsonObjectConverter::JsonObjectStringToUStruct<FAdInfo>(Body, &AdInfo, 0, 0);
+    constexpr int32 DelegateThreadCount = (int32)EAppLovinMAXEvent::Count;
 
-        FAdError AdError;
-        FJsonObjectConverter::JsonObjectStringToUStruct<FAdError>(Body, &AdError, 0, 0);
+    // Queue that the static delegate of each event is broadcast through, or nullptr to broadcast immediately. Resolved by SetDelegateThread,
+    // so that the native plugin threads only load a pointer per event. Queues live until exit, so a loaded pointer stays valid.
+    std::atomic<FAppLovinMAXEventQueue *> StaticDelegateQueues[DelegateThreadCount] = {};
 
-        if (Name == TEXT("OnBannerAdLoadedEvent"))
-        {
-            UAppLovinMAX::OnBannerAdLoadedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnBannerAdLoadFailedEvent"))
-        {
-            UAppLovinMAX::OnBannerAdLoadFailedDelegate.Broadcast(AdInfo, AdError);
-            UAppLovinMAXDelegate::BroadcastAdErrorEvent(Name, AdInfo, AdError);
-        }
-        else if (Name == TEXT("OnBannerAdClickedEvent"))
-        {
-            UAppLovinMAX::OnBannerAdClickedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnBannerAdExpandedEvent"))
-        {
-            UAppLovinMAX::OnBannerAdExpandedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnBannerAdCollapsedEvent"))
-        {
-            UAppLovinMAX::OnBannerAdCollapsedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnBannerAdRevenuePaidEvent"))
-        {
-            UAppLovinMAX::OnBannerAdRevenuePaidDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnMRecAdLoadedEvent"))
-        {
-            UAppLovinMAX::OnMRecAdLoadedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnMRecAdLoadFailedEvent"))
-        {
-            UAppLovinMAX::OnMRecAdLoadFailedDelegate.Broadcast(AdInfo, AdError);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnMRecAdClickedEvent"))
-        {
-            UAppLovinMAX::OnMRecAdClickedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnMRecAdExpandedEvent"))
-        {
-            UAppLovinMAX::OnMRecAdExpandedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnMRecAdCollapsedEvent"))
-        {
-            UAppLovinMAX::OnMRecAdCollapsedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnMRecAdRevenuePaidEvent"))
-        {
-            UAppLovinMAX::OnMRecAdRevenuePaidDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnInterstitialAdLoadedEvent"))
-        {
-            UAppLovinMAX::OnInterstitialAdLoadedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnInterstitialAdLoadFailedEvent"))
-        {
-            UAppLovinMAX::OnInterstitialAdLoadFailedDelegate.Broadcast(AdInfo, AdError);
-            UAppLovinMAXDelegate::BroadcastAdErrorEvent(Name, AdInfo, AdError);
-        }
-        else if (Name == TEXT("OnInterstitialAdDisplayedEvent"))
-        {
-            UAppLovinMAX::OnInterstitialAdDisplayedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnInterstitialAdDisplayFailedEvent"))
-        {
-            UAppLovinMAX::OnInterstitialAdDisplayFailedDelegate.Broadcast(AdInfo, AdError);
-            UAppLovinMAXDelegate::BroadcastAdErrorEvent(Name, AdInfo, AdError);
-        }
-        else if (Name == TEXT("OnInterstitialAdHiddenEvent"))
-        {
-            UAppLovinMAX::OnInterstitialAdHiddenDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnInterstitialAdClickedEvent"))
-        {
-            UAppLovinMAX::OnInterstitialAdClickedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnInterstitialAdRevenuePaidEvent"))
-        {
-            UAppLovinMAX::OnInterstitialAdRevenuePaidDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnRewardedAdLoadedEvent"))
-        {
-            UAppLovinMAX::OnRewardedAdLoadedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnRewardedAdLoadFailedEvent"))
-        {
-            UAppLovinMAX::OnRewardedAdLoadFailedDelegate.Broadcast(AdInfo, AdError);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnRewardedAdDisplayedEvent"))
-        {
-            UAppLovinMAX::OnRewardedAdDisplayedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnRewardedAdDisplayFailedEvent"))
-        {
-            UAppLovinMAX::OnRewardedAdDisplayFailedDelegate.Broadcast(AdInfo, AdError);
-            UAppLovinMAXDelegate::BroadcastAdErrorEvent(Name, AdInfo, AdError);
-        }
-        else if (Name == TEXT("OnRewardedAdHiddenEvent"))
-        {
-            UAppLovinMAX::OnRewardedAdHiddenDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnRewardedAdClickedEvent"))
-        {
-            UAppLovinMAX::OnRewardedAdClickedDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
-        }
-        else if (Name == TEXT("OnRewardedAdRevenuePaidEvent"))
+    void BroadcastStaticAdDelegates(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)
+    {
+        switch (Event)
         {
-            UAppLovinMAX::OnRewardedAdRevenuePaidDelegate.Broadcast(AdInfo);
-            UAppLovinMAXDelegate::BroadcastAdEvent(Name, AdInfo);
+            case EAppLovinMAXEvent::BannerAdLoaded:
+                UAppLovinMAX::OnBannerAdLoadedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::BannerAdLoadFailed:
+                UAppLovinMAX::OnBannerAdLoadFailedDelegate.Broadcast(AdInfo, AdError);
+                break;
+            case EAppLovinMAXEvent::BannerAdClicked:
+                UAppLovinMAX::OnBannerAdClickedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::BannerAdExpanded:
+                UAppLovinMAX::OnBannerAdExpandedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::BannerAdCollapsed:
+                UAppLovinMAX::OnBannerAdCollapsedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::BannerAdRevenuePaid:
+                UAppLovinMAX::OnBannerAdRevenuePaidDelegate.Broadcast(AdInfo);
+                break;
+
+            case EAppLovinMAXEvent::MRecAdLoaded:
+                UAppLovinMAX::OnMRecAdLoadedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::MRecAdLoadFailed:
+                UAppLovinMAX::OnMRecAdLoadFailedDelegate.Broadcast(AdInfo, AdError);
+                break;
+            case EAppLovinMAXEvent::MRecAdClicked:
+                UAppLovinMAX::OnMRecAdClickedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::MRecAdExpanded:
+                UAppLovinMAX::OnMRecAdExpandedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::MRecAdCollapsed:
+                UAppLovinMAX::OnMRecAdCollapsedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::MRecAdRevenuePaid:
+                UAppLovinMAX::OnMRecAdRevenuePaidDelegate.Broadcast(AdInfo);
+                break;
+
+            case EAppLovinMAXEvent::InterstitialAdLoaded:
+                UAppLovinMAX::OnInterstitialAdLoadedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::InterstitialAdLoadFailed:
+                UAppLovinMAX::OnInterstitialAdLoadFailedDelegate.Broadcast(AdInfo, AdError);
+                break;
+            case EAppLovinMAXEvent::InterstitialAdDisplayed:
+                UAppLovinMAX::OnInterstitialAdDisplayedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::InterstitialAdDisplayFailed:
+                UAppLovinMAX::OnInterstitialAdDisplayFailedDelegate.Broadcast(AdInfo, AdError);
+                break;
+            case EAppLovinMAXEvent::InterstitialAdHidden:
+                UAppLovinMAX::OnInterstitialAdHiddenDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::InterstitialAdClicked:
+                UAppLovinMAX::OnInterstitialAdClickedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::InterstitialAdRevenuePaid:
+                UAppLovinMAX::OnInterstitialAdRevenuePaidDelegate.Broadcast(AdInfo);
+                break;
+
+            case EAppLovinMAXEvent::RewardedAdLoaded:
+                UAppLovinMAX::OnRewardedAdLoadedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::RewardedAdLoadFailed:
+                UAppLovinMAX::OnRewardedAdLoadFailedDelegate.Broadcast(AdInfo, AdError);
+                break;
+            case EAppLovinMAXEvent::RewardedAdDisplayed:
+                UAppLovinMAX::OnRewardedAdDisplayedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::RewardedAdDisplayFailed:
+                UAppLovinMAX::OnRewardedAdDisplayFailedDelegate.Broadcast(AdInfo, AdError);
+                break;
+            case EAppLovinMAXEvent::RewardedAdHidden:
+                UAppLovinMAX::OnRewardedAdHiddenDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::RewardedAdClicked:
+                UAppLovinMAX::OnRewardedAdClickedDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::RewardedAdRevenuePaid:
+                UAppLovinMAX::OnRewardedAdRevenuePaidDelegate.Broadcast(AdInfo);
+                break;
+            case EAppLovinMAXEvent::RewardedAdReceivedReward:
+                UAppLovinMAX::OnRewardedAdReceivedRewardDelegate.Broadcast(AdInfo, Reward);
+                break;
+
+            default:
+                MAX_USER_WARN("Unhandled MAX ad event fired: %s", AppLovinMAXEvent::ToName(Event));
+                break;
         }
-        else if (Name == TEXT("OnRewardedAdReceivedRewardEvent"))
+    }
+
+    void BroadcastQueuedStaticDelegates(const FAppLovinMAXQueuedEvent &QueuedEvent)
+    {
+        MAX_TRACE_DYNAMIC_SCOPE(AppLovinMAXEvent::ToName(QueuedEvent.Event));
+
+        switch (QueuedEvent.Event)
         {
-            FAdReward Reward;
-            FJsonObjectConverter::JsonObjectStringToUStruct<FAdReward>(Body, &Reward, 0, 0);
-            UAppLovinMAX::OnRewardedAdReceivedRewardDelegate.Broadcast(AdInfo, Reward);
-            UAppLovinMAXDelegate::BroadcastRewardedAdReceivedRewardEvent(AdInfo, Reward);
+            case EAppLovinMAXEvent::SdkInitialized:
+                UAppLovinMAX::OnSdkInitializedDelegate.Broadcast(QueuedEvent.SdkConfiguration);
+                break;
+            case EAppLovinMAXEvent::CmpCompleted:
+                UAppLovinMAX::OnCmpCompletedDelegate.Broadcast(QueuedEvent.CmpError);
+                break;
+            default:
+                BroadcastStaticAdDelegates(QueuedEvent.Event, QueuedEvent.AdInfo, QueuedEvent.AdError, QueuedEvent.Reward);
+                break;
         }
-        else
+    }
+
+    // Returns the queue for a task graph thread, creating it on first use.
+    // There is one queue per thread, so that every delegate on that thread sees events in the order they were received.
+    FAppLovinMAXEventQueue *FindOrAddStaticDelegateQueue(ENamedThreads::Type NamedThread)
+    {
+        static FCriticalSection QueuesLock;
+        static TMap<int32, TUniquePtr<FAppLovinMAXEventQueue>> Queues;
+
+        FScopeLock Lock(&QueuesLock);
+        TUniquePtr<FAppLovinMAXEventQueue> &Queue = Queues.FindOrAdd((int32)NamedThread);
+        if (!Queue)
         {
-            MAX_USER_WARN("Unknown MAX ad event fired: %s", *Name);
+            Queue = MakeUnique<FAppLovinMAXEventQueue>(&BroadcastQueuedStaticDelegates, NamedThread);
         }
+        return Queue.Get();
+    }
+
+    // Returns the queue for the thread that the static delegate of an event is broadcast on, or nullptr to broadcast immediately
+    FAppLovinMAXEventQueue *GetStaticDelegateQueue(EAppLovinMAXEvent Event)
+    {
+        return StaticDelegateQueues[(int32)Event].load(std::memory_order_acquire);
+    }
+} // namespace
+
+void UAppLovinMAX::SetDelegateThread(EAppLovinMAXEvent Event, EDelegateThread Thread, ENamedThreads::Type NamedThread)
+{
+    if (Event >= EAppLovinMAXEvent::Count) return;
+
+    FAppLovinMAXEventQueue *Queue = nullptr;
+    if (Thread != EDelegateThread::AnyThread)
+    {
+        Queue = FindOrAddStaticDelegateQueue(Thread == EDelegateThread::GameThread ? ENamedThreads::GameThread : NamedThread);
     }
+    StaticDelegateQueues[(int32)Event].store(Queue, std::memory_order_release);
 }
 
-// MARK: - Utility Methods
+void UAppLovinMAX::SetAllDelegateThreads(EDelegateThread Thread, ENamedThreads::Type NamedThread)
+{
+    for (int32 Index = 0; Index < DelegateThreadCount; Index++)
+    {
+        SetDelegateThread((EAppLovinMAXEvent)Index, Thread, NamedThread);
+    }
+}
 
-FString UAppLovinMAX::GetAdViewPositionString(EAdViewPosition Position)
+// Broadcasts a decoded ad event to the C++ delegates, on their configured thread, and to the Blueprint delegate components
+void DispatchAdEvent(EAppLovinMAXEvent Event, FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)
 {
-    if (Position == EAdViewPosition::TopLeft)
+    MAX_TRACE_DYNAMIC_SCOPE(AppLovinMAXEvent::ToName(Event));
+
+    const double SecondsSinceNativeEvent = AppLovinMAXTrace::GetSecondsSinceNativeTimestamp(AdInfo.NativeTimestamp);
+    if (SecondsSinceNativeEvent >= 0.0)
     {
-        return TEXT("top_left");
+        TRACE_COUNTER_SET(AppLovinMAXForwardLatency, SecondsSinceNativeEvent * 1000.0);
     }
-    else if (Position == EAdViewPosition::TopCenter)
+
+    // The native plugins send the handle given by RegisterNativeAdUnitHandle. Events without one, e.g. from an older native plugin, look it up here once
+    // rather than in every handler. A sent handle is checked against the identifier since replayed event logs may come from another session.
+    const FString *RegisteredIdentifier = AppLovinMAXAdUnits::GetIdentifier(AdInfo.AdUnitHandle);
+    if (RegisteredIdentifier == nullptr || !RegisteredIdentifier->Equals(AdInfo.AdUnitIdentifier, ESearchCase::CaseSensitive))
     {
-        return TEXT("top_center");
+        AdInfo.AdUnitHandle = AdInfo.AdUnitIdentifier.IsEmpty() ? FAdUnitHandle() : AppLovinMAXAdUnits::Register(AdInfo.AdUnitIdentifier);
     }
-    else if (Position == EAdViewPosition::TopRight)
+
+    // Update readiness and revenue before broadcasting so that handlers see the new state
+    AppLovinMAXAdReadiness::HandleAdEvent(Event, AdInfo.AdUnitHandle);
+    AppLovinMAXRevenue::HandleAdEvent(Event, AdInfo);
+    AppLovinMAXFullscreenThrottle::HandleAdEvent(Event);
+    AppLovinMAXAdInventory::HandleAdEvent(Event, AdInfo.AdUnitIdentifier);
+    AppLovinMAXAdUnitListeners::HandleAdEvent(Event, AdInfo, AdError, Reward);
+
+    const bool bIsAdErrorEvent = AppLovinMAXEvent::IsAdErrorEvent(Event);
+    const bool bIsRewardEvent = Event == EAppLovinMAXEvent::RewardedAdReceivedReward;
+
+    if (FAppLovinMAXEventQueue *Queue = GetStaticDelegateQueue(Event))
     {
-        return TEXT("top_right");
+        FAppLovinMAXQueuedEvent QueuedEvent;
+        QueuedEvent.Event = Event;
+        QueuedEvent.AdInfo = AdInfo;
+        if (bIsAdErrorEvent) QueuedEvent.AdError = AdError;
+        if (bIsRewardEvent) QueuedEvent.Reward = Reward;
+        Queue->Enqueue(MoveTemp(QueuedEvent));
     }
-    else if (Position == EAdViewPosition::Centered)
+    else
     {
-        return TEXT("centered");
+        BroadcastStaticAdDelegates(Event, AdInfo, AdError, Reward);
     }
-    else if (Position == EAdViewPosition::CenterLeft)
+
+    if (bIsRewardEvent)
     {
-        return TEXT("center_left");
+        UAppLovinMAXDelegate::BroadcastRewardedAdReceivedRewardEvent(AdInfo, Reward);
     }
-    else if (Position == EAdViewPosition::CenterRight)
+    else if (bIsAdErrorEvent)
     {
-        return TEXT("center_right");
+        UAppLovinMAXDelegate::BroadcastAdErrorEvent(Event, AdInfo, AdError);
     }
-    else if (Position == EAdViewPosition::BottomLeft)
+    else
     {
-        return TEXT("bottom_left");
+        UAppLovinMAXDelegate::BroadcastAdEvent(Event, AdInfo);
     }
-    else if (Position == EAdViewPosition::BottomCenter)
+}
+
+void ForwardEvent(const FString &Name, const FString &Body)
+{
+    MAX_TRACE_SCOPE("AppLovinMAX::ForwardEvent");
+    AppLovinMAXEventRecorder::RecordEvent(Name, Body);
+
+    const EAppLovinMAXEvent Event = AppLovinMAXEvent::FromName(Name);
+    AppLovinMAXStats::RecordEventReceived(Event);
+    if (Event == EAppLovinMAXEvent::Unknown)
     {
-        return TEXT("bottom_center");
+        MAX_USER_WARN("Unknown MAX ad event fired: %s", *Name);
+        return;
     }
-    else // Position == EAdViewPosition::BottomRight
+
+    if (Event == EAppLovinMAXEvent::SdkInitialized)
     {
-        return TEXT("bottom_right");
+        AppLovinMAXStartup::HandleSdkInitialized();
+
+        FSdkConfiguration SdkConfiguration;
+        AppLovinMAXEventDecoder::DecodeSdkConfiguration(Body, SdkConfiguration);
+        AppLovinMAXSdkState::ApplySdkConfiguration(SdkConfiguration);
+        if (FAppLovinMAXEventQueue *Queue = GetStaticDelegateQueue(Event))
+        {
+            FAppLovinMAXQueuedEvent QueuedEvent;
+            QueuedEvent.Event = Event;
+            QueuedEvent.SdkConfiguration = SdkConfiguration;
+            Queue->Enqueue(MoveTemp(QueuedEvent));
+        }
+        else
+        {
+            UAppLovinMAX::OnSdkInitializedDelegate.Broadcast(SdkConfiguration);
+        }
+        UAppLovinMAXDelegate::BroadcastSdkInitializedEvent(SdkConfiguration);
+        return;
     }
+
+    if (Event == EAppLovinMAXEvent::CmpCompleted)
+    {
+        FCmpError CmpError;
+        AppLovinMAXEventDecoder::DecodeCmpError(Body, CmpError);
+        AppLovinMAXSdkState::HandleCmpCompleted();
+        if (FAppLovinMAXEventQueue *Queue = GetStaticDelegateQueue(Event))
+        {
+            FAppLovinMAXQueuedEvent QueuedEvent;
+            QueuedEvent.Event = Event;
+            QueuedEvent.CmpError = CmpError;
+            Queue->Enqueue(MoveTemp(QueuedEvent));
+        }
+        else
+        {
+            UAppLovinMAX::OnCmpCompletedDelegate.Broadcast(CmpError);
+        }
+        UAppLovinMAXDelegate::BroadcastCmpCompletedEvent(CmpError);
+        return;
+    }
+
+    // Ad Events: decode the body once, filling only the structs this event carries
+    FAdInfo AdInfo;
+    FAdError AdError;
+    FAdReward Reward;
+    const bool bIsAdErrorEvent = AppLovinMAXEvent::IsAdErrorEvent(Event);
+    const bool bIsRewardEvent = Event == EAppLovinMAXEvent::RewardedAdReceivedReward;
+    if (!AppLovinMAXEventDecoder::DecodeAdEvent(Body, AdInfo, bIsAdErrorEvent ? &AdError : nullptr, bIsRewardEvent ? &Reward : nullptr))
+    {
+        MAX_USER_WARN("Malformed body for MAX ad event %s: %s", *Name, *Body);
+    }
+
+    DispatchAdEvent(Event, AdInfo, AdError, Reward);
 }
 
-FString UAppLovinMAX::GetUserGeographyString(EConsentFlowUserGeography UserGeography)
+// Binary bodies are only sent for ad events; SDK and CMP events always use ForwardEvent
+void ForwardBinaryEvent(const FString &Name, const uint8 *Data, int32 Length)
 {
-    // NOTE: For Android, strings must match the original enum in Java
-    if (UserGeography == EConsentFlowUserGeography::GDPR)
+    MAX_TRACE_SCOPE("AppLovinMAX::ForwardBinaryEvent");
+    AppLovinMAXEventRecorder::RecordBinaryEvent(Name, Data, Length);
+
+    const EAppLovinMAXEvent Event = AppLovinMAXEvent::FromName(Name);
+    AppLovinMAXStats::RecordEventReceived(Event);
+    if (Event == EAppLovinMAXEvent::SdkInitialized || Event == EAppLovinMAXEvent::CmpCompleted)
     {
-        return TEXT("GDPR");
+        MAX_USER_WARN("MAX SDK event fired with a binary body, which is only supported for ad events: %s", *Name);
+        return;
     }
-    else if (UserGeography == EConsentFlowUserGeography::Other)
+
+    if (Event == EAppLovinMAXEvent::Unknown)
     {
-        return TEXT("OTHER");
+        MAX_USER_WARN("Unknown MAX ad event fired: %s", *Name);
+        return;
     }
-    else // UserGeography == EConsentFlowUserGeography::Unknown
+
+    FAdInfo AdInfo;
+    FAdError AdError;
+    FAdReward Reward;
+    const bool bIsAdErrorEvent = AppLovinMAXEvent::IsAdErrorEvent(Event);
+    const bool bIsRewardEvent = Event == EAppLovinMAXEvent::RewardedAdReceivedReward;
+    if (!AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data, Length, AdInfo, bIsAdErrorEvent ? &AdError : nullptr, bIsRewardEvent ? &Reward : nullptr))
     {
-        return TEXT("UNKNOWN");
+        MAX_USER_WARN("Malformed binary body for MAX ad event %s (%d bytes)", *Name, Length);
+    }
+
+    DispatchAdEvent(Event, AdInfo, AdError, Reward);
+}
+
+// MARK: - Utility Methods
+
+// Returns string literals so that no FString is allocated per call
+const TCHAR *UAppLovinMAX::GetUserGeographyString(EConsentFlowUserGeography UserGeography)
+{
+    // NOTE: For Android, strings must match the original enum in Java
+    switch (UserGeography)
+    {
+        case EConsentFlowUserGeography::GDPR:  return TEXT("GDPR");
+        case EConsentFlowUserGeography::Other: return TEXT("OTHER");
+        case EConsentFlowUserGeography::Unknown:
+        default:                               return TEXT("UNKNOWN");
     }
 }
 
@@ -781,6 +1758,40 @@ void UAppLovinMAX::ValidateAdUnitIdentifier(const FString &AdUnitIdentifier, con
     }
 }
 
+const FString *UAppLovinMAX::ResolveAdUnitHandle(FAdUnitHandle AdUnit, const TCHAR *DebugPurpose)
+{
+    const FString *AdUnitIdentifier = AppLovinMAXAdUnits::GetIdentifier(AdUnit);
+    if (AdUnitIdentifier == nullptr)
+    {
+        MAX_USER_ERROR("Invalid MAX Ads Ad Unit handle %d specified for: %s", AdUnit.Index, DebugPurpose);
+    }
+    return AdUnitIdentifier;
+}
+
+namespace
+{
+    // One bit per handle that the native plugin was given
+    std::atomic<uint64> NativeAdUnitHandleBits[FAdUnitHandle::MaxAdUnits / 64];
+} // namespace
+
+// Called before the calls that create native ads, so that the native plugin can send the handle with the events of the ad unit
+void UAppLovinMAX::RegisterNativeAdUnitHandle(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier)
+{
+    // Events of ad units without a handle carry only their identifier
+    if (!AdUnit.IsValid()) return;
+
+    const uint64 Bit = 1ull << (AdUnit.Index % 64);
+    if (NativeAdUnitHandleBits[AdUnit.Index / 64].fetch_or(Bit, std::memory_order_relaxed) & Bit) return;
+
+#if PLATFORM_IOS
+    [GetIOSPlugin() setAdUnitHandle:AdUnit.Index forAdUnitIdentifier:AdUnitIdentifier.GetNSString()];
+#elif PLATFORM_ANDROID
+    GetAndroidPlugin()->SetAdUnitHandle(AdUnitIdentifier, AdUnit.Index);
+#else
+    GetMockPlugin()->SetAdUnitHandle(AdUnitIdentifier, AdUnit.Index);
+#endif
+}
+
 // MARK: - IOS
 
 #if PLATFORM_IOS
@@ -839,19 +1850,72 @@ void ForwardAndroidEvent(JNIEnv *env, jobject thiz, jstring name, jstring params
     ForwardEvent(Name, Params);
 }
 
+// Ad events encoded by MaxUnrealPlugin.BinaryEventWriter are decoded straight from the direct ByteBuffer, skipping the JSON string round trip
+void ForwardAndroidBinaryEvent(JNIEnv *env, jobject thiz, jstring name, jobject body, jint length)
+{
+    FString Name = FJavaHelper::FStringFromParam(env, name);
+    const uint8 *Data = (const uint8 *)env->GetDirectBufferAddress(body);
+    if (Data == nullptr || length < 0 || length > env->GetDirectBufferCapacity(body))
+    {
+        MAX_USER_ERROR("Invalid buffer for MAX ad event: %s", *Name);
+        return;
+    }
+
+    ForwardBinaryEvent(Name, Data, length);
+}
+
 // UE5
 extern "C" JNIEXPORT void JNICALL Java_com_epicgames_unreal_GameActivity_00024MaxUnrealPluginListener_forwardEvent(JNIEnv *env, jobject thiz, jstring name, jstring params)
 {
     ForwardAndroidEvent(env, thiz, name, params);
 }
 
+extern "C" JNIEXPORT void JNICALL Java_com_epicgames_unreal_GameActivity_00024MaxUnrealPluginListener_forwardBinaryEvent(JNIEnv *env, jobject thiz, jstring name, jobject body, jint length)
+{
+    ForwardAndroidBinaryEvent(env, thiz, name, body, length);
+}
+
+// Called for the trim memory levels that MaxUnrealPlugin treats as memory pressure
+extern "C" JNIEXPORT void JNICALL Java_com_epicgames_unreal_GameActivity_00024MaxUnrealPluginListener_forwardTrimMemory(JNIEnv *env, jobject thiz, jint level)
+{
+    MAX_USER_DEBUG("Received trim memory level %d", (int32)level);
+    AppLovinMAXAdInventory::HandleMemoryWarning();
+}
+
 TSharedPtr<FJavaAndroidMaxUnrealPlugin> UAppLovinMAX::GetAndroidPlugin()
 {
-    static TSharedPtr<FJavaAndroidMaxUnrealPlugin, ESPMode::ThreadSafe> Instance;
-    if (!Instance.IsValid())
+    // Function-local static so that callers racing InitializeAsync wait for the single instance instead of creating their own
+    static TSharedPtr<FJavaAndroidMaxUnrealPlugin, ESPMode::ThreadSafe> Instance = MakeShared<FJavaAndroidMaxUnrealPlugin, ESPMode::ThreadSafe>();
+    return Instance;
+}
+
+FAppLovinMAXAdViewCommandBuffer &UAppLovinMAX::GetAdViewCommandBuffer()
+{
+    static FAppLovinMAXAdViewCommandBuffer Instance([](const FString &SerializedCommands)
     {
-        Instance = MakeShared<FJavaAndroidMaxUnrealPlugin, ESPMode::ThreadSafe>();
-    }
+        GetAndroidPlugin()->ApplyAdViewCommands(SerializedCommands);
+    });
+    return Instance;
+}
+
+FAppLovinMAXEventBatch &UAppLovinMAX::GetEventBatch()
+{
+    static FAppLovinMAXEventBatch Instance([](const FString &SerializedEvents)
+    {
+        GetAndroidPlugin()->TrackEvents(SerializedEvents);
+    });
+    return Instance;
+}
+
+#endif
+
+// MARK: - Mock
+
+#if !PLATFORM_IOS && !PLATFORM_ANDROID
+
+TSharedPtr<FAppLovinMAXMockPlugin> UAppLovinMAX::GetMockPlugin()
+{
+    static TSharedPtr<FAppLovinMAXMockPlugin> Instance = MakeShared<FAppLovinMAXMockPlugin>(&ForwardEvent);
     return Instance;
 }
 
@@ -0,0 +1,530 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXAdInventory.h"
+#include "AppLovinMAXLogger.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace
+{
+    // Native destroys finish asynchronously, so each eviction is measured on the next step rather than right after the call
+    constexpr float InventoryStepInterval = 0.25f;
+
+    struct FAdViewRecord
+    {
+        bool bIsMRec = false;
+        EAdViewPosition Position = EAdViewPosition::BottomCenter;
+        FString Placement;
+        TOptional<FColor> BackgroundColor;
+        TMap<FString, FString> ExtraParameters;
+        bool bIsVisible = false;
+        bool bIsEvicted = false;
+        int32 EvictionIndex = INDEX_NONE;
+    };
+
+    struct FFullscreenAdRecord
+    {
+        bool bIsRewarded = false;
+        bool bIsLoaded = false;
+        bool bIsEvicted = false;
+        int32 EvictionIndex = INDEX_NONE;
+    };
+
+    FCriticalSection InventoryLock;
+    TMap<FString, FAdViewRecord> AdViewRecords;
+    TMap<FString, FFullscreenAdRecord> FullscreenAdRecords;
+    TArray<FAdInventoryEviction> Evictions;
+
+    std::atomic<bool> bIsInventoryEnabled{false};
+    std::atomic<bool> bIsEvictionRequested{false};
+    std::atomic<double> LastMemoryWarningTime{0.0};
+
+    // Only touched on the game thread
+    bool bEvictLoadedFullscreenAds = true;
+    float InventoryRestoreDelay = 30.0f;
+    FTSTicker::FDelegateHandle InventoryTickerHandle;
+    int32 PendingMeasurementIndex = INDEX_NONE;
+    uint64 UsedPhysicalBeforeEviction = 0;
+    FCoreDelegates::FOnMemoryWarning PreviousMemoryWarningHandler;
+    bool bIsMemoryWarningHooked = false;
+
+    // Set while the inventory calls into UAppLovinMAX itself, so that its own destroys and re-creates are not recorded as the game's
+    thread_local bool bIsApplyingInventoryChange = false;
+
+    struct FScopedInventoryChange
+    {
+        FScopedInventoryChange() { bIsApplyingInventoryChange = true; }
+        ~FScopedInventoryChange() { bIsApplyingInventoryChange = false; }
+    };
+
+    bool ShouldRecord()
+    {
+        return bIsInventoryEnabled.load(std::memory_order_relaxed) && !bIsApplyingInventoryChange;
+    }
+
+    EAdInventoryFormat GetAdViewFormat(const FAdViewRecord &Record)
+    {
+        return Record.bIsMRec ? EAdInventoryFormat::MRec : EAdInventoryFormat::Banner;
+    }
+
+    EAdInventoryFormat GetFullscreenAdFormat(const FFullscreenAdRecord &Record)
+    {
+        return Record.bIsRewarded ? EAdInventoryFormat::Rewarded : EAdInventoryFormat::Interstitial;
+    }
+
+    // Evicting an ad that DestroyRewardedAd cannot release would only throw away a loaded ad and reload it later
+    bool CanEvictFullscreenAd(const FFullscreenAdRecord &Record)
+    {
+#if PLATFORM_IOS
+        return !Record.bIsRewarded;
+#else
+        return true;
+#endif
+    }
+
+    void OnEngineMemoryWarning(const FGenericMemoryWarningContext &Context)
+    {
+        AppLovinMAXAdInventory::HandleMemoryWarning();
+        PreviousMemoryWarningHandler.ExecuteIfBound(Context);
+    }
+
+    // Re-creates an evicted ad view from its record. Expects InventoryLock to not be held, since UAppLovinMAX calls back into the inventory.
+    void RecreateAdView(const FString &AdUnitIdentifier, const FAdViewRecord &Record)
+    {
+        FScopedInventoryChange InventoryChange;
+
+        if (Record.bIsMRec)
+        {
+            UAppLovinMAX::CreateMRec(AdUnitIdentifier, Record.Position);
+            if (!Record.Placement.IsEmpty()) UAppLovinMAX::SetMRecPlacement(AdUnitIdentifier, Record.Placement);
+            for (const TPair<FString, FString> &Parameter : Record.ExtraParameters)
+            {
+                UAppLovinMAX::SetMRecExtraParameter(AdUnitIdentifier, Parameter.Key, Parameter.Value);
+            }
+        }
+        else
+        {
+            UAppLovinMAX::CreateBanner(AdUnitIdentifier, Record.Position);
+            if (Record.BackgroundColor.IsSet()) UAppLovinMAX::SetBannerBackgroundColor(AdUnitIdentifier, Record.BackgroundColor.GetValue());
+            if (!Record.Placement.IsEmpty()) UAppLovinMAX::SetBannerPlacement(AdUnitIdentifier, Record.Placement);
+            for (const TPair<FString, FString> &Parameter : Record.ExtraParameters)
+            {
+                UAppLovinMAX::SetBannerExtraParameter(AdUnitIdentifier, Parameter.Key, Parameter.Value);
+            }
+        }
+
+        // The native plugins tie auto-refresh to visibility, and the width to the position replayed above. A hidden ad view is hidden
+        // explicitly so that it does not start refreshing, while a shown one is shown by the call that re-created it.
+        if (!Record.bIsVisible)
+        {
+            if (Record.bIsMRec)
+            {
+                UAppLovinMAX::HideMRec(AdUnitIdentifier);
+            }
+            else
+            {
+                UAppLovinMAX::HideBanner(AdUnitIdentifier);
+            }
+        }
+    }
+
+    // Evicts the cheapest remaining ad and returns true, or returns false if nothing is left to evict
+    bool EvictNext()
+    {
+        FString AdUnitIdentifier;
+        EAdInventoryFormat AdFormat = EAdInventoryFormat::Rewarded;
+        bool bFound = false;
+
+        {
+            FScopeLock Lock(&InventoryLock);
+
+            for (const TPair<FString, FAdViewRecord> &Entry : AdViewRecords)
+            {
+                const FAdViewRecord &Record = Entry.Value;
+                if (Record.bIsVisible || Record.bIsEvicted) continue;
+
+                if (!bFound || GetAdViewFormat(Record) < AdFormat)
+                {
+                    AdUnitIdentifier = Entry.Key;
+                    AdFormat = GetAdViewFormat(Record);
+                    bFound = true;
+                }
+            }
+
+            if (bEvictLoadedFullscreenAds)
+            {
+                for (const TPair<FString, FFullscreenAdRecord> &Entry : FullscreenAdRecords)
+                {
+                    const FFullscreenAdRecord &Record = Entry.Value;
+                    if (!Record.bIsLoaded || Record.bIsEvicted || !CanEvictFullscreenAd(Record)) continue;
+
+                    if (!bFound || GetFullscreenAdFormat(Record) < AdFormat)
+                    {
+                        AdUnitIdentifier = Entry.Key;
+                        AdFormat = GetFullscreenAdFormat(Record);
+                        bFound = true;
+                    }
+                }
+            }
+
+            if (!bFound) return false;
+
+            FAdInventoryEviction &Eviction = Evictions.AddDefaulted_GetRef();
+            Eviction.AdUnitIdentifier = AdUnitIdentifier;
+            Eviction.AdFormat = AdFormat;
+            PendingMeasurementIndex = Evictions.Num() - 1;
+
+            if (AdFormat == EAdInventoryFormat::MRec || AdFormat == EAdInventoryFormat::Banner)
+            {
+                FAdViewRecord &Record = AdViewRecords[AdUnitIdentifier];
+                Record.bIsEvicted = true;
+                Record.EvictionIndex = PendingMeasurementIndex;
+            }
+            else
+            {
+                FFullscreenAdRecord &Record = FullscreenAdRecords[AdUnitIdentifier];
+                Record.bIsLoaded = false;
+                Record.bIsEvicted = true;
+                Record.EvictionIndex = PendingMeasurementIndex;
+            }
+        }
+
+        UsedPhysicalBeforeEviction = FPlatformMemory::GetStats().UsedPhysical;
+
+        FScopedInventoryChange InventoryChange;
+        switch (AdFormat)
+        {
+            case EAdInventoryFormat::MRec:
+                UAppLovinMAX::DestroyMRec(AdUnitIdentifier);
+                break;
+            case EAdInventoryFormat::Banner:
+                UAppLovinMAX::DestroyBanner(AdUnitIdentifier);
+                break;
+            case EAdInventoryFormat::Interstitial:
+                UAppLovinMAX::DestroyInterstitial(AdUnitIdentifier);
+                break;
+            case EAdInventoryFormat::Rewarded:
+                UAppLovinMAX::DestroyRewardedAd(AdUnitIdentifier);
+                break;
+        }
+
+        MAX_USER_DEBUG("Evicted %s ad unit %s under memory pressure", *StaticEnum<EAdInventoryFormat>()->GetNameStringByValue((int64)AdFormat), *AdUnitIdentifier);
+        return true;
+    }
+
+    // Restores the most valuable evicted ad and returns true, or returns false if nothing is evicted
+    bool RestoreNext()
+    {
+        FString AdUnitIdentifier;
+        EAdInventoryFormat AdFormat = EAdInventoryFormat::MRec;
+        FAdViewRecord AdViewRecord;
+        bool bFound = false;
+
+        {
+            FScopeLock Lock(&InventoryLock);
+
+            for (const TPair<FString, FFullscreenAdRecord> &Entry : FullscreenAdRecords)
+            {
+                if (Entry.Value.bIsEvicted && (!bFound || GetFullscreenAdFormat(Entry.Value) > AdFormat))
+                {
+                    AdUnitIdentifier = Entry.Key;
+                    AdFormat = GetFullscreenAdFormat(Entry.Value);
+                    bFound = true;
+                }
+            }
+
+            for (const TPair<FString, FAdViewRecord> &Entry : AdViewRecords)
+            {
+                if (Entry.Value.bIsEvicted && (!bFound || GetAdViewFormat(Entry.Value) > AdFormat))
+                {
+                    AdUnitIdentifier = Entry.Key;
+                    AdFormat = GetAdViewFormat(Entry.Value);
+                    bFound = true;
+                }
+            }
+
+            if (!bFound) return false;
+
+            int32 EvictionIndex = INDEX_NONE;
+            if (AdFormat == EAdInventoryFormat::MRec || AdFormat == EAdInventoryFormat::Banner)
+            {
+                FAdViewRecord &Record = AdViewRecords[AdUnitIdentifier];
+                Record.bIsEvicted = false;
+                EvictionIndex = Record.EvictionIndex;
+                AdViewRecord = Record;
+            }
+            else
+            {
+                FFullscreenAdRecord &Record = FullscreenAdRecords[AdUnitIdentifier];
+                Record.bIsEvicted = false;
+                EvictionIndex = Record.EvictionIndex;
+            }
+
+            if (Evictions.IsValidIndex(EvictionIndex))
+            {
+                Evictions[EvictionIndex].bIsRestored = true;
+            }
+        }
+
+        switch (AdFormat)
+        {
+            case EAdInventoryFormat::MRec:
+            case EAdInventoryFormat::Banner:
+                RecreateAdView(AdUnitIdentifier, AdViewRecord);
+                break;
+            case EAdInventoryFormat::Interstitial:
+            {
+                FScopedInventoryChange InventoryChange;
+                UAppLovinMAX::LoadInterstitial(AdUnitIdentifier);
+                break;
+            }
+            case EAdInventoryFormat::Rewarded:
+            {
+                FScopedInventoryChange InventoryChange;
+                UAppLovinMAX::LoadRewardedAd(AdUnitIdentifier);
+                break;
+            }
+        }
+
+        MAX_USER_DEBUG("Restored %s ad unit %s after memory pressure eased", *StaticEnum<EAdInventoryFormat>()->GetNameStringByValue((int64)AdFormat), *AdUnitIdentifier);
+        return true;
+    }
+
+    // One eviction or restore per step, so that each eviction can be measured on its own and restores are spread over several frames
+    bool TickInventory(float DeltaTime)
+    {
+        if (PendingMeasurementIndex != INDEX_NONE)
+        {
+            const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+            const int64 FreedBytes = UsedPhysicalBeforeEviction > UsedPhysical ? (int64)(UsedPhysicalBeforeEviction - UsedPhysical) : 0;
+
+            FScopeLock Lock(&InventoryLock);
+            if (Evictions.IsValidIndex(PendingMeasurementIndex))
+            {
+                Evictions[PendingMeasurementIndex].FreedBytes = FreedBytes;
+                MAX_USER_DEBUG("Eviction of ad unit %s freed %lld bytes", *Evictions[PendingMeasurementIndex].AdUnitIdentifier, FreedBytes);
+            }
+            PendingMeasurementIndex = INDEX_NONE;
+        }
+
+        if (bIsEvictionRequested.load())
+        {
+            if (!EvictNext())
+            {
+                bIsEvictionRequested.store(false);
+            }
+            return true;
+        }
+
+        if (FPlatformTime::Seconds() - LastMemoryWarningTime.load() >= InventoryRestoreDelay)
+        {
+            RestoreNext();
+        }
+
+        return true;
+    }
+} // namespace
+
+void AppLovinMAXAdInventory::SetEnabled(bool bEnabled, bool bEvictLoadedAds, float RestoreDelay)
+{
+    check(IsInGameThread());
+
+    bEvictLoadedFullscreenAds = bEvictLoadedAds;
+    InventoryRestoreDelay = FMath::Max(RestoreDelay, 0.0f);
+
+    if (bEnabled == bIsInventoryEnabled.load()) return;
+
+    if (bEnabled)
+    {
+        // The engine delegate is single-cast, so keep the game's handler and call it after ours
+        PreviousMemoryWarningHandler = FCoreDelegates::GetMemoryWarningDelegate();
+        FCoreDelegates::GetMemoryWarningDelegate().BindStatic(&OnEngineMemoryWarning);
+        bIsMemoryWarningHooked = true;
+
+        InventoryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickInventory), InventoryStepInterval);
+        bIsInventoryEnabled.store(true);
+        return;
+    }
+
+    bIsEvictionRequested.store(false);
+    while (RestoreNext())
+    {
+    }
+
+    bIsInventoryEnabled.store(false);
+    Shutdown();
+
+    FScopeLock Lock(&InventoryLock);
+    AdViewRecords.Empty();
+    FullscreenAdRecords.Empty();
+    Evictions.Empty();
+    PendingMeasurementIndex = INDEX_NONE;
+}
+
+void AppLovinMAXAdInventory::HandleMemoryWarning()
+{
+    if (!bIsInventoryEnabled.load(std::memory_order_relaxed)) return;
+
+    LastMemoryWarningTime.store(FPlatformTime::Seconds());
+    bIsEvictionRequested.store(true);
+}
+
+TArray<FAdInventoryEviction> AppLovinMAXAdInventory::GetEvictions()
+{
+    FScopeLock Lock(&InventoryLock);
+    return Evictions;
+}
+
+void AppLovinMAXAdInventory::Shutdown()
+{
+    if (InventoryTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(InventoryTickerHandle);
+        InventoryTickerHandle.Reset();
+    }
+
+    if (bIsMemoryWarningHooked)
+    {
+        FCoreDelegates::GetMemoryWarningDelegate() = PreviousMemoryWarningHandler;
+        PreviousMemoryWarningHandler.Unbind();
+        bIsMemoryWarningHooked = false;
+    }
+}
+
+// MARK: - Recording
+
+void AppLovinMAXAdInventory::RecordAdViewCreated(const FString &AdUnitIdentifier, bool bIsMRec, EAdViewPosition Position)
+{
+    if (!ShouldRecord()) return;
+
+    FScopeLock Lock(&InventoryLock);
+    FAdViewRecord &Record = AdViewRecords.Add(AdUnitIdentifier);
+    Record.bIsMRec = bIsMRec;
+    Record.Position = Position;
+}
+
+void AppLovinMAXAdInventory::RecordAdViewPosition(const FString &AdUnitIdentifier, EAdViewPosition Position)
+{
+    if (!ShouldRecord()) return;
+
+    FScopeLock Lock(&InventoryLock);
+    if (FAdViewRecord *Record = AdViewRecords.Find(AdUnitIdentifier))
+    {
+        Record->Position = Position;
+    }
+}
+
+void AppLovinMAXAdInventory::RecordAdViewPlacement(const FString &AdUnitIdentifier, const FString &Placement)
+{
+    if (!ShouldRecord()) return;
+
+    FScopeLock Lock(&InventoryLock);
+    if (FAdViewRecord *Record = AdViewRecords.Find(AdUnitIdentifier))
+    {
+        Record->Placement = Placement;
+    }
+}
+
+void AppLovinMAXAdInventory::RecordAdViewExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value)
+{
+    if (!ShouldRecord()) return;
+
+    FScopeLock Lock(&InventoryLock);
+    if (FAdViewRecord *Record = AdViewRecords.Find(AdUnitIdentifier))
+    {
+        Record->ExtraParameters.Add(Key, Value);
+    }
+}
+
+void AppLovinMAXAdInventory::RecordBannerBackgroundColor(const FString &AdUnitIdentifier, const FColor &Color)
+{
+    if (!ShouldRecord()) return;
+
+    FScopeLock Lock(&InventoryLock);
+    if (FAdViewRecord *Record = AdViewRecords.Find(AdUnitIdentifier))
+    {
+        Record->BackgroundColor = Color;
+    }
+}
+
+void AppLovinMAXAdInventory::RecordAdViewDestroyed(const FString &AdUnitIdentifier)
+{
+    if (!ShouldRecord()) return;
+
+    FScopeLock Lock(&InventoryLock);
+    AdViewRecords.Remove(AdUnitIdentifier);
+}
+
+void AppLovinMAXAdInventory::RecordAdViewVisibility(const FString &AdUnitIdentifier, bool bIsVisible)
+{
+    if (!ShouldRecord()) return;
+
+    FAdViewRecord EvictedRecord;
+    {
+        FScopeLock Lock(&InventoryLock);
+        FAdViewRecord *Record = AdViewRecords.Find(AdUnitIdentifier);
+        if (Record == nullptr) return;
+
+        Record->bIsVisible = bIsVisible;
+        if (!bIsVisible || !Record->bIsEvicted) return;
+
+        Record->bIsEvicted = false;
+        if (Evictions.IsValidIndex(Record->EvictionIndex))
+        {
+            Evictions[Record->EvictionIndex].bIsRestored = true;
+        }
+        EvictedRecord = *Record;
+    }
+
+    RecreateAdView(AdUnitIdentifier, EvictedRecord);
+}
+
+void AppLovinMAXAdInventory::RecordFullscreenAdLoad(const FString &AdUnitIdentifier, bool bIsRewarded)
+{
+    if (!ShouldRecord()) return;
+
+    FScopeLock Lock(&InventoryLock);
+    FFullscreenAdRecord &Record = FullscreenAdRecords.FindOrAdd(AdUnitIdentifier);
+    Record.bIsRewarded = bIsRewarded;
+    Record.bIsEvicted = false;
+}
+
+void AppLovinMAXAdInventory::HandleAdEvent(EAppLovinMAXEvent Event, const FString &AdUnitIdentifier)
+{
+    if (!bIsInventoryEnabled.load(std::memory_order_relaxed)) return;
+
+    bool bIsLoaded = false;
+    bool bIsRewarded = false;
+    switch (Event)
+    {
+        case EAppLovinMAXEvent::InterstitialAdLoaded:
+            bIsLoaded = true;
+            break;
+        case EAppLovinMAXEvent::RewardedAdLoaded:
+            bIsLoaded = true;
+            bIsRewarded = true;
+            break;
+        case EAppLovinMAXEvent::InterstitialAdLoadFailed:
+        case EAppLovinMAXEvent::InterstitialAdDisplayed:
+        case EAppLovinMAXEvent::InterstitialAdDisplayFailed:
+        case EAppLovinMAXEvent::InterstitialAdHidden:
+            break;
+        case EAppLovinMAXEvent::RewardedAdLoadFailed:
+        case EAppLovinMAXEvent::RewardedAdDisplayed:
+        case EAppLovinMAXEvent::RewardedAdDisplayFailed:
+        case EAppLovinMAXEvent::RewardedAdHidden:
+            bIsRewarded = true;
+            break;
+        default:
+            return;
+    }
+
+    FScopeLock Lock(&InventoryLock);
+    FFullscreenAdRecord &Record = FullscreenAdRecords.FindOrAdd(AdUnitIdentifier);
+    Record.bIsRewarded = bIsRewarded;
+    Record.bIsLoaded = bIsLoaded;
+}
@@ -0,0 +1,48 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdInventoryEviction.h"
+#include "AppLovinMAX.h"
+#include "AppLovinMAXEvent.h"
+
+/**
+ * Opt-in eviction of hidden ad views and loaded fullscreen ads under memory pressure, driven by engine memory warnings and the
+ * Android trim memory callback. Evictions run on the game thread one at a time, cheapest to lose first: hidden MRECs, hidden banners,
+ * interstitials, then rewarded ads. Visible ad views are never evicted. Once no warning has arrived for the restore delay,
+ * evicted ad views are re-created with the state the game last gave them and evicted ads are reloaded, most valuable first.
+ *
+ * The state needed to re-create ad views is recorded from the UAppLovinMAX calls while enabled, so enable it before creating ad views.
+ */
+namespace AppLovinMAXAdInventory
+{
+    /** Enables or disables eviction. Disabling restores everything that is still evicted. Must be called on the game thread. */
+    void SetEnabled(bool bEnabled, bool bEvictLoadedAds, float RestoreDelay);
+
+    /** Starts evicting if enabled. Safe to call from any thread. */
+    void HandleMemoryWarning();
+
+    /** Returns the evictions made since inventory management was enabled, oldest first. */
+    TArray<FAdInventoryEviction> GetEvictions();
+
+    /** Unhooks from the engine memory warnings. Called when the module shuts down. */
+    void Shutdown();
+
+    // Ad view state, recorded so that evicted ad views can be re-created as the game left them. Calls made by the inventory itself are ignored.
+    void RecordAdViewCreated(const FString &AdUnitIdentifier, bool bIsMRec, EAdViewPosition Position);
+    void RecordAdViewPosition(const FString &AdUnitIdentifier, EAdViewPosition Position);
+    void RecordAdViewPlacement(const FString &AdUnitIdentifier, const FString &Placement);
+    void RecordAdViewExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value);
+    void RecordBannerBackgroundColor(const FString &AdUnitIdentifier, const FColor &Color);
+    void RecordAdViewDestroyed(const FString &AdUnitIdentifier);
+
+    /** Records a show or hide. Showing an evicted ad view re-creates it first, so the show reaches a live ad view. */
+    void RecordAdViewVisibility(const FString &AdUnitIdentifier, bool bIsVisible);
+
+    /** Records a load requested by the game, which takes over reloading an evicted ad. */
+    void RecordFullscreenAdLoad(const FString &AdUnitIdentifier, bool bIsRewarded);
+
+    /** Tracks which interstitial and rewarded ads are loaded and not yet shown. Safe to call from any thread. */
+    void HandleAdEvent(EAppLovinMAXEvent Event, const FString &AdUnitIdentifier);
+} // namespace AppLovinMAXAdInventory
@@ -0,0 +1,52 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXAdReadiness.h"
+#include <atomic>
+
+namespace
+{
+    // Indexed by ad unit handle
+    std::atomic<bool> ReadinessByAdUnit[FAdUnitHandle::MaxAdUnits];
+} // namespace
+
+void AppLovinMAXAdReadiness::HandleAdEvent(EAppLovinMAXEvent Event, FAdUnitHandle AdUnit)
+{
+    switch (Event)
+    {
+        case EAppLovinMAXEvent::InterstitialAdLoaded:
+        case EAppLovinMAXEvent::RewardedAdLoaded:
+            SetReady(AdUnit, true);
+            break;
+
+        // A displayed ad is consumed, so the ad unit is not ready again until the next load
+        case EAppLovinMAXEvent::InterstitialAdLoadFailed:
+        case EAppLovinMAXEvent::InterstitialAdDisplayed:
+        case EAppLovinMAXEvent::InterstitialAdDisplayFailed:
+        case EAppLovinMAXEvent::InterstitialAdHidden:
+        case EAppLovinMAXEvent::RewardedAdLoadFailed:
+        case EAppLovinMAXEvent::RewardedAdDisplayed:
+        case EAppLovinMAXEvent::RewardedAdDisplayFailed:
+        case EAppLovinMAXEvent::RewardedAdHidden:
+            SetReady(AdUnit, false);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void AppLovinMAXAdReadiness::SetReady(FAdUnitHandle AdUnit, bool bIsReady)
+{
+    if (AdUnit.IsValid())
+    {
+        ReadinessByAdUnit[AdUnit.Index].store(bIsReady, std::memory_order_release);
+    }
+}
+
+bool AppLovinMAXAdReadiness::TryGetReady(FAdUnitHandle AdUnit, bool &bOutIsReady)
+{
+    if (!AdUnit.IsValid()) return false;
+
+    bOutIsReady = ReadinessByAdUnit[AdUnit.Index].load(std::memory_order_acquire);
+    return true;
+}
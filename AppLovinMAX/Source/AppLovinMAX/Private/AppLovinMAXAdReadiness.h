@@ -0,0 +1,26 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdUnitHandle.h"
+#include "AppLovinMAXEvent.h"
+
+/**
+ * Per-ad-unit readiness of interstitial and rewarded ads, kept up to date from the ad events forwarded by the native plugins.
+ * Reads and writes are lock-free so that readiness can be polled every frame without a round trip to the native plugin.
+ */
+namespace AppLovinMAXAdReadiness
+{
+    /** Updates the readiness of the ad unit if the event is a load, display or hide event for an interstitial or rewarded ad. */
+    void HandleAdEvent(EAppLovinMAXEvent Event, FAdUnitHandle AdUnit);
+
+    /** Sets the cached readiness of an ad unit, e.g. after checking with the native plugin. */
+    void SetReady(FAdUnitHandle AdUnit, bool bIsReady);
+
+    /**
+     * Gets the cached readiness of an ad unit. Ad units without any events yet are not ready.
+     * @return False if the handle is invalid, e.g. because too many ad units are in use, in which case the native plugin must be asked instead.
+     */
+    bool TryGetReady(FAdUnitHandle AdUnit, bool &bOutIsReady);
+} // namespace AppLovinMAXAdReadiness
@@ -0,0 +1,83 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXAdUnitListeners.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace
+{
+    struct FListenerEntry
+    {
+        uint32 Id = 0;
+        AppLovinMAXAdUnitListeners::FListener Listener;
+
+        // Set once the listener returned true or was removed, so that a snapshot taken before that does not call it again
+        std::atomic<bool> bIsDone{false};
+    };
+
+    using FListenerEntryRef = TSharedRef<FListenerEntry, ESPMode::ThreadSafe>;
+
+    FCriticalSection ListenersLock;
+    std::atomic<uint32> NextListenerId{1};
+
+    // Indexed by ad unit handle. The counts are read without the lock to skip ad units that have no listeners.
+    TArray<FListenerEntryRef> ListenersByAdUnit[FAdUnitHandle::MaxAdUnits];
+    std::atomic<int32> ListenerCounts[FAdUnitHandle::MaxAdUnits];
+
+    void RemoveEntry(int32 AdUnitIndex, uint32 ListenerId)
+    {
+        FScopeLock Lock(&ListenersLock);
+        TArray<FListenerEntryRef> &Listeners = ListenersByAdUnit[AdUnitIndex];
+        const int32 Index = Listeners.IndexOfByPredicate([ListenerId](const FListenerEntryRef &Entry) { return Entry->Id == ListenerId; });
+        if (Index == INDEX_NONE) return;
+
+        Listeners[Index]->bIsDone = true;
+        Listeners.RemoveAt(Index);
+        ListenerCounts[AdUnitIndex].store(Listeners.Num(), std::memory_order_release);
+    }
+} // namespace
+
+uint32 AppLovinMAXAdUnitListeners::Add(FAdUnitHandle AdUnit, FListener &&Listener)
+{
+    if (!AdUnit.IsValid()) return 0;
+
+    FListenerEntryRef Entry = MakeShared<FListenerEntry, ESPMode::ThreadSafe>();
+    Entry->Id = NextListenerId.fetch_add(1, std::memory_order_relaxed);
+    Entry->Listener = MoveTemp(Listener);
+
+    FScopeLock Lock(&ListenersLock);
+    TArray<FListenerEntryRef> &Listeners = ListenersByAdUnit[AdUnit.Index];
+    Listeners.Add(Entry);
+    ListenerCounts[AdUnit.Index].store(Listeners.Num(), std::memory_order_release);
+    return Entry->Id;
+}
+
+void AppLovinMAXAdUnitListeners::Remove(FAdUnitHandle AdUnit, uint32 ListenerId)
+{
+    if (!AdUnit.IsValid() || ListenerId == 0) return;
+
+    RemoveEntry(AdUnit.Index, ListenerId);
+}
+
+void AppLovinMAXAdUnitListeners::HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)
+{
+    const FAdUnitHandle AdUnit = AdInfo.AdUnitHandle;
+    if (!AdUnit.IsValid() || ListenerCounts[AdUnit.Index].load(std::memory_order_acquire) == 0) return;
+
+    // Listeners are called on a snapshot so that they can add or remove listeners, e.g. to load again once an ad is hidden
+    TArray<FListenerEntryRef, TInlineAllocator<4>> Snapshot;
+    {
+        FScopeLock Lock(&ListenersLock);
+        Snapshot.Append(ListenersByAdUnit[AdUnit.Index]);
+    }
+
+    for (const FListenerEntryRef &Entry : Snapshot)
+    {
+        if (Entry->bIsDone.load()) continue;
+
+        if (Entry->Listener(Event, AdInfo, AdError, Reward) && !Entry->bIsDone.exchange(true))
+        {
+            RemoveEntry(AdUnit.Index, Entry->Id);
+        }
+    }
+}
@@ -0,0 +1,36 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdError.h"
+#include "AdInfo.h"
+#include "AdReward.h"
+#include "AdUnitHandle.h"
+#include "AppLovinMAXEvent.h"
+
+/**
+ * Listeners for the ad events of a single ad unit, looked up by handle when an event is dispatched instead of filtering a global delegate.
+ * Listeners are called on the thread the event is dispatched on, outside of any lock, so they may add or remove listeners.
+ * Dispatch costs a single atomic load while no listener is registered.
+ */
+namespace AppLovinMAXAdUnitListeners
+{
+    /**
+     * Called for every ad event of the ad unit. The error is only set for ad error events and the reward for reward events.
+     * Returns true once the listener is done, which removes it.
+     */
+    using FListener = TFunction<bool(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)>;
+
+    /**
+     * Registers a listener for the ad events of an ad unit. Safe to call from any thread.
+     * @return Identifier to remove the listener with, or 0 if the handle is invalid.
+     */
+    uint32 Add(FAdUnitHandle AdUnit, FListener &&Listener);
+
+    /** Removes a listener that is not done yet. Once this returns, the listener is not called again unless it is running on another thread. */
+    void Remove(FAdUnitHandle AdUnit, uint32 ListenerId);
+
+    /** Calls the listeners of the ad unit the event is for. */
+    void HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward);
+} // namespace AppLovinMAXAdUnitListeners
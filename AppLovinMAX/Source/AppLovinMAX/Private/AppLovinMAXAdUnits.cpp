@@ -0,0 +1,32 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXAdUnits.h"
+#include "AppLovinMAXInternTable.h"
+#include "AppLovinMAXLogger.h"
+
+namespace
+{
+    // The slot index is the handle
+    TAppLovinMAXInternTable<FAdUnitHandle::MaxAdUnits> AdUnitIdentifiers;
+} // namespace
+
+FAdUnitHandle AppLovinMAXAdUnits::Register(const FString &AdUnitIdentifier)
+{
+    const int32 Index = AdUnitIdentifiers.FindOrAdd(AdUnitIdentifier);
+    if (Index != INDEX_NONE)
+    {
+        return FAdUnitHandle(Index);
+    }
+
+    static std::atomic<bool> bHasWarned{false};
+    if (!bHasWarned.exchange(true))
+    {
+        MAX_USER_ERROR("More than %d ad units in use, additional ad units cannot be registered", FAdUnitHandle::MaxAdUnits);
+    }
+    return FAdUnitHandle();
+}
+
+const FString *AppLovinMAXAdUnits::GetIdentifier(FAdUnitHandle Handle)
+{
+    return AdUnitIdentifiers.Get(Handle.Index);
+}
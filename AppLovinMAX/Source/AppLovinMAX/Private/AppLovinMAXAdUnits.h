@@ -0,0 +1,22 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdUnitHandle.h"
+
+/**
+ * Registry of the ad units in use, mapping each ad unit identifier to a small FAdUnitHandle.
+ * Ad units are registered by the API calls and by the events forwarded from the native plugins. Registration and lookups are lock-free.
+ */
+namespace AppLovinMAXAdUnits
+{
+    /**
+     * Gets the handle of an ad unit, registering it the first time.
+     * @return An invalid handle if FAdUnitHandle::MaxAdUnits ad units are already registered.
+     */
+    FAdUnitHandle Register(const FString &AdUnitIdentifier);
+
+    /** Gets the identifier of a registered ad unit, or nullptr if the handle is invalid or not registered. */
+    const FString *GetIdentifier(FAdUnitHandle Handle);
+} // namespace AppLovinMAXAdUnits
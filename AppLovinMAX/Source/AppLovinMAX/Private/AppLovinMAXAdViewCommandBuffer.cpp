@@ -0,0 +1,128 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXAdViewCommandBuffer.h"
+#include "AppLovinMAXUtils.h"
+#include "Misc/ScopeLock.h"
+
+FAppLovinMAXAdViewCommandBuffer::FAppLovinMAXAdViewCommandBuffer(FSubmitCallback &&InSubmitCallback)
+    : SubmitCallback(MoveTemp(InSubmitCallback))
+{
+    SerializedCommands.Reserve(1024);
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAppLovinMAXAdViewCommandBuffer::Tick));
+}
+
+FAppLovinMAXAdViewCommandBuffer::~FAppLovinMAXAdViewCommandBuffer()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+// MARK: - Recording
+
+void FAppLovinMAXAdViewCommandBuffer::SetPlacement(const FString &AdUnitIdentifier, bool bIsMRec, const FString &Placement)
+{
+    FScopeLock ScopeLock(&Lock);
+    FindOrAddCommand(AdUnitIdentifier, bIsMRec).Placement = Placement;
+}
+
+void FAppLovinMAXAdViewCommandBuffer::SetExtraParameter(const FString &AdUnitIdentifier, bool bIsMRec, const FString &Key, const FString &Value)
+{
+    FScopeLock ScopeLock(&Lock);
+    FindOrAddCommand(AdUnitIdentifier, bIsMRec).ExtraParameters.Add(Key, Value);
+}
+
+void FAppLovinMAXAdViewCommandBuffer::SetBackgroundColor(const FString &AdUnitIdentifier, bool bIsMRec, const FString &HexColorCode)
+{
+    FScopeLock ScopeLock(&Lock);
+    FindOrAddCommand(AdUnitIdentifier, bIsMRec).BackgroundColor = HexColorCode;
+}
+
+void FAppLovinMAXAdViewCommandBuffer::SetPosition(const FString &AdUnitIdentifier, bool bIsMRec, int32 Position)
+{
+    FScopeLock ScopeLock(&Lock);
+    FindOrAddCommand(AdUnitIdentifier, bIsMRec).Position = Position;
+}
+
+void FAppLovinMAXAdViewCommandBuffer::SetVisible(const FString &AdUnitIdentifier, bool bIsMRec, bool bIsVisible)
+{
+    FScopeLock ScopeLock(&Lock);
+    FindOrAddCommand(AdUnitIdentifier, bIsMRec).bIsVisible = bIsVisible;
+}
+
+FAppLovinMAXAdViewCommandBuffer::FAdViewCommand &FAppLovinMAXAdViewCommandBuffer::FindOrAddCommand(const FString &AdUnitIdentifier, bool bIsMRec)
+{
+    FAdViewCommand *Command = PendingCommands.Find(AdUnitIdentifier);
+    if (Command == nullptr)
+    {
+        Command = &PendingCommands.Add(AdUnitIdentifier);
+        Command->bIsMRec = bIsMRec;
+    }
+    return *Command;
+}
+
+// MARK: - Submission
+
+void FAppLovinMAXAdViewCommandBuffer::Submit()
+{
+    // Serialized and submitted under the lock so that submissions from different threads cannot reach the native plugin out of order
+    FScopeLock ScopeLock(&Lock);
+    if (PendingCommands.Num() == 0) return;
+
+    SerializedCommands.Reset();
+    SerializedCommands.AppendChar(TEXT('['));
+    bool bIsFirstCommand = true;
+    for (const TPair<FString, FAdViewCommand> &Entry : PendingCommands)
+    {
+        const FAdViewCommand &Command = Entry.Value;
+        if (!bIsFirstCommand)
+        {
+            SerializedCommands.AppendChar(TEXT(','));
+        }
+        bIsFirstCommand = false;
+
+        SerializedCommands += TEXT("{\"adUnitId\":");
+        AppLovinMAXUtils::AppendJsonString(SerializedCommands, Entry.Key);
+        SerializedCommands += Command.bIsMRec ? TEXT(",\"isMRec\":true") : TEXT(",\"isMRec\":false");
+
+        if (Command.Placement.IsSet())
+        {
+            SerializedCommands += TEXT(",\"placement\":");
+            AppLovinMAXUtils::AppendJsonString(SerializedCommands, Command.Placement.GetValue());
+        }
+
+        if (Command.ExtraParameters.Num() > 0)
+        {
+            SerializedCommands += TEXT(",\"extraParameters\":");
+            AppLovinMAXUtils::AppendSerializedMap(SerializedCommands, Command.ExtraParameters);
+        }
+
+        if (Command.BackgroundColor.IsSet())
+        {
+            SerializedCommands += TEXT(",\"backgroundColor\":");
+            AppLovinMAXUtils::AppendJsonString(SerializedCommands, Command.BackgroundColor.GetValue());
+        }
+
+        if (Command.Position.IsSet())
+        {
+            SerializedCommands += TEXT(",\"position\":");
+            SerializedCommands.AppendInt(Command.Position.GetValue());
+        }
+
+        if (Command.bIsVisible.IsSet())
+        {
+            SerializedCommands += Command.bIsVisible.GetValue() ? TEXT(",\"visible\":true") : TEXT(",\"visible\":false");
+        }
+
+        SerializedCommands.AppendChar(TEXT('}'));
+    }
+    SerializedCommands.AppendChar(TEXT(']'));
+
+    PendingCommands.Reset();
+    SubmitCallback(SerializedCommands);
+}
+
+bool FAppLovinMAXAdViewCommandBuffer::Tick(float DeltaTime)
+{
+    Submit();
+    return true;
+}
@@ -0,0 +1,56 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Records banner and MREC operations and submits them to the native plugin in one call per frame.
+ * Operations on the same ad view are collapsed to their final state, e.g. several position updates keep only the last one
+ * and a show followed by a hide keeps only the hide, so the native plugin lays out each ad view at most once per submission.
+ */
+class FAppLovinMAXAdViewCommandBuffer
+{
+public:
+    /** Receives a JSON array with one object per ad view, holding the ad unit identifier, format and the state that changed. */
+    using FSubmitCallback = TFunction<void(const FString &SerializedCommands)>;
+
+    explicit FAppLovinMAXAdViewCommandBuffer(FSubmitCallback &&InSubmitCallback);
+    ~FAppLovinMAXAdViewCommandBuffer();
+
+    // MARK: Recording
+    void SetPlacement(const FString &AdUnitIdentifier, bool bIsMRec, const FString &Placement);
+    void SetExtraParameter(const FString &AdUnitIdentifier, bool bIsMRec, const FString &Key, const FString &Value);
+    void SetBackgroundColor(const FString &AdUnitIdentifier, bool bIsMRec, const FString &HexColorCode);
+    void SetPosition(const FString &AdUnitIdentifier, bool bIsMRec, int32 Position);
+    void SetVisible(const FString &AdUnitIdentifier, bool bIsMRec, bool bIsVisible);
+
+    /** Sends the recorded operations to the submit callback. Called every frame, and before ad views are created or destroyed to keep operations in order. */
+    void Submit();
+
+private:
+    struct FAdViewCommand
+    {
+        bool bIsMRec = false;
+        TOptional<FString> Placement;
+        TOptional<FString> BackgroundColor;
+        TOptional<int32> Position;
+        TOptional<bool> bIsVisible;
+
+        // Later values for the same key replace earlier ones
+        TMap<FString, FString> ExtraParameters;
+    };
+
+    bool Tick(float DeltaTime);
+
+    // Expects Lock to be held
+    FAdViewCommand &FindOrAddCommand(const FString &AdUnitIdentifier, bool bIsMRec);
+
+    FSubmitCallback SubmitCallback;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    FCriticalSection Lock;
+    TMap<FString, FAdViewCommand> PendingCommands;
+    FString SerializedCommands;
+};
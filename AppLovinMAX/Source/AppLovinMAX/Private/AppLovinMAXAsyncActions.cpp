@@ -0,0 +1,245 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXAsyncActions.h"
+#include "AppLovinMAX.h"
+#include "AppLovinMAXAdUnitListeners.h"
+#include "AppLovinMAXAdUnits.h"
+#include "Async/Async.h"
+
+static_assert((int32)EAppLovinMAXEvent::Count <= 64, "Ad action event masks must fit in a uint64");
+
+// MARK: - Ad Action
+
+void UAppLovinMAXAdAction::Activate()
+{
+    ListenedAdUnit = AdUnitIdentifier.IsEmpty() ? FAdUnitHandle() : AppLovinMAXAdUnits::Register(AdUnitIdentifier);
+    if (!ListenedAdUnit.IsValid())
+    {
+        FAdInfo AdInfo;
+        AdInfo.AdUnitIdentifier = AdUnitIdentifier;
+
+        FAdError AdError;
+        AdError.Code = -1;
+        AdError.Message = AdUnitIdentifier.IsEmpty()
+                              ? FString(TEXT("No MAX Ads Ad Unit ID specified"))
+                              : FString::Printf(TEXT("More than %d MAX Ads Ad Units in use, cannot wait for: %s"), FAdUnitHandle::MaxAdUnits, *AdUnitIdentifier);
+
+        HandleAdEvent(GetFailureEvent(), AdInfo, AdError, FAdReward());
+        Finish();
+        return;
+    }
+
+    // Only the events with a pin hop to the game thread, decided here so that the native plugin's thread never touches this object
+    uint64 HandledEventMask = 0;
+    for (int32 Index = 0; Index < (int32)EAppLovinMAXEvent::Count; Index++)
+    {
+        if (IsHandledEvent((EAppLovinMAXEvent)Index))
+        {
+            HandledEventMask |= 1ull << Index;
+        }
+    }
+
+    TWeakObjectPtr<UAppLovinMAXAdAction> WeakThis(this);
+    ListenerId = AppLovinMAXAdUnitListeners::Add(ListenedAdUnit, [WeakThis, HandledEventMask](EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)
+    {
+        if ((HandledEventMask & (1ull << (int32)Event)) == 0) return false;
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Event, AdInfo, AdError, Reward]()
+        {
+            UAppLovinMAXAdAction *Action = WeakThis.Get();
+            if (Action != nullptr && !Action->bIsFinished && Action->HandleAdEvent(Event, AdInfo, AdError, Reward))
+            {
+                Action->Finish();
+            }
+        });
+
+        // The node removes itself on the game thread once it is done
+        return false;
+    });
+
+    StartAdCall(ListenedAdUnit);
+}
+
+void UAppLovinMAXAdAction::BeginDestroy()
+{
+    // Destroyed with the game instance before the ad events it waits for arrived
+    AppLovinMAXAdUnitListeners::Remove(ListenedAdUnit, ListenerId);
+    ListenerId = 0;
+
+    Super::BeginDestroy();
+}
+
+void UAppLovinMAXAdAction::Finish()
+{
+    bIsFinished = true;
+    AppLovinMAXAdUnitListeners::Remove(ListenedAdUnit, ListenerId);
+    ListenerId = 0;
+    SetReadyToDestroy();
+}
+
+// MARK: - Load Ad Action
+
+UAppLovinMAXLoadAdAction *UAppLovinMAXLoadAdAction::LoadInterstitialAndWait(UObject *WorldContextObject, const FString &AdUnitIdentifier)
+{
+    UAppLovinMAXLoadAdAction *Action = NewObject<UAppLovinMAXLoadAdAction>();
+    Action->AdUnitIdentifier = AdUnitIdentifier;
+    Action->bIsRewarded = false;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+UAppLovinMAXLoadAdAction *UAppLovinMAXLoadAdAction::LoadRewardedAdAndWait(UObject *WorldContextObject, const FString &AdUnitIdentifier)
+{
+    UAppLovinMAXLoadAdAction *Action = NewObject<UAppLovinMAXLoadAdAction>();
+    Action->AdUnitIdentifier = AdUnitIdentifier;
+    Action->bIsRewarded = true;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void UAppLovinMAXLoadAdAction::StartAdCall(FAdUnitHandle AdUnit)
+{
+    if (bIsRewarded)
+    {
+        UAppLovinMAX::LoadRewardedAd(AdUnit);
+    }
+    else
+    {
+        UAppLovinMAX::LoadInterstitial(AdUnit);
+    }
+}
+
+bool UAppLovinMAXLoadAdAction::IsHandledEvent(EAppLovinMAXEvent Event) const
+{
+    return bIsRewarded
+        ? Event == EAppLovinMAXEvent::RewardedAdLoaded || Event == EAppLovinMAXEvent::RewardedAdLoadFailed
+        : Event == EAppLovinMAXEvent::InterstitialAdLoaded || Event == EAppLovinMAXEvent::InterstitialAdLoadFailed;
+}
+
+bool UAppLovinMAXLoadAdAction::HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)
+{
+    switch (Event)
+    {
+        case EAppLovinMAXEvent::InterstitialAdLoaded:
+        case EAppLovinMAXEvent::RewardedAdLoaded:
+            Loaded.Broadcast(AdInfo, AdError);
+            return true;
+
+        case EAppLovinMAXEvent::InterstitialAdLoadFailed:
+        case EAppLovinMAXEvent::RewardedAdLoadFailed:
+            Failed.Broadcast(AdInfo, AdError);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+EAppLovinMAXEvent UAppLovinMAXLoadAdAction::GetFailureEvent() const
+{
+    return bIsRewarded ? EAppLovinMAXEvent::RewardedAdLoadFailed : EAppLovinMAXEvent::InterstitialAdLoadFailed;
+}
+
+// MARK: - Show Interstitial Action
+
+UAppLovinMAXShowInterstitialAction *UAppLovinMAXShowInterstitialAction::ShowInterstitialAndWait(UObject *WorldContextObject, const FString &AdUnitIdentifier, const FString &Placement)
+{
+    UAppLovinMAXShowInterstitialAction *Action = NewObject<UAppLovinMAXShowInterstitialAction>();
+    Action->AdUnitIdentifier = AdUnitIdentifier;
+    Action->Placement = Placement;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void UAppLovinMAXShowInterstitialAction::StartAdCall(FAdUnitHandle AdUnit)
+{
+    UAppLovinMAX::ShowInterstitial(AdUnit, Placement);
+}
+
+bool UAppLovinMAXShowInterstitialAction::IsHandledEvent(EAppLovinMAXEvent Event) const
+{
+    return Event == EAppLovinMAXEvent::InterstitialAdDisplayed
+        || Event == EAppLovinMAXEvent::InterstitialAdHidden
+        || Event == EAppLovinMAXEvent::InterstitialAdDisplayFailed;
+}
+
+bool UAppLovinMAXShowInterstitialAction::HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)
+{
+    switch (Event)
+    {
+        case EAppLovinMAXEvent::InterstitialAdDisplayed:
+            Displayed.Broadcast(AdInfo, AdError);
+            return false;
+
+        case EAppLovinMAXEvent::InterstitialAdHidden:
+            Hidden.Broadcast(AdInfo, AdError);
+            return true;
+
+        case EAppLovinMAXEvent::InterstitialAdDisplayFailed:
+            Failed.Broadcast(AdInfo, AdError);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+EAppLovinMAXEvent UAppLovinMAXShowInterstitialAction::GetFailureEvent() const
+{
+    return EAppLovinMAXEvent::InterstitialAdDisplayFailed;
+}
+
+// MARK: - Show Rewarded Ad Action
+
+UAppLovinMAXShowRewardedAdAction *UAppLovinMAXShowRewardedAdAction::ShowRewardedAdAndAwaitReward(UObject *WorldContextObject, const FString &AdUnitIdentifier, const FString &Placement)
+{
+    UAppLovinMAXShowRewardedAdAction *Action = NewObject<UAppLovinMAXShowRewardedAdAction>();
+    Action->AdUnitIdentifier = AdUnitIdentifier;
+    Action->Placement = Placement;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void UAppLovinMAXShowRewardedAdAction::StartAdCall(FAdUnitHandle AdUnit)
+{
+    UAppLovinMAX::ShowRewardedAd(AdUnit, Placement);
+}
+
+bool UAppLovinMAXShowRewardedAdAction::IsHandledEvent(EAppLovinMAXEvent Event) const
+{
+    return Event == EAppLovinMAXEvent::RewardedAdDisplayed
+        || Event == EAppLovinMAXEvent::RewardedAdReceivedReward
+        || Event == EAppLovinMAXEvent::RewardedAdHidden
+        || Event == EAppLovinMAXEvent::RewardedAdDisplayFailed;
+}
+
+bool UAppLovinMAXShowRewardedAdAction::HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward)
+{
+    switch (Event)
+    {
+        case EAppLovinMAXEvent::RewardedAdDisplayed:
+            Displayed.Broadcast(AdInfo, AdError, Reward);
+            return false;
+
+        case EAppLovinMAXEvent::RewardedAdReceivedReward:
+            EarnedReward = Reward;
+            Rewarded.Broadcast(AdInfo, AdError, Reward);
+            return false;
+
+        case EAppLovinMAXEvent::RewardedAdHidden:
+            Hidden.Broadcast(AdInfo, AdError, EarnedReward);
+            return true;
+
+        case EAppLovinMAXEvent::RewardedAdDisplayFailed:
+            Failed.Broadcast(AdInfo, AdError, Reward);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+EAppLovinMAXEvent UAppLovinMAXShowRewardedAdAction::GetFailureEvent() const
+{
+    return EAppLovinMAXEvent::RewardedAdDisplayFailed;
+}
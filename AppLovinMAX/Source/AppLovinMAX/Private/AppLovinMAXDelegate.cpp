@@ -1,10 +1,10 @@
 // Copyright AppLovin Corporation. All Rights Reserved.
 
 #include "AppLovinMAXDelegate.h"
-#include "Async/Async.h"
-#include "Async/TaskGraphInterfaces.h"
+#include "AppLovinMAXEventQueue.h"
+#include "AppLovinMAXLogger.h"
+#include "AppLovinMAXTrace.h"
 #include "Engine/World.h"
-#include "UObject/UObjectIterator.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
 bool IsValidDelegate(UAppLovinMAXDelegate *Delegate)
@@ -16,172 +16,249 @@ bool IsValidDelegate(UAppLovinMAXDelegate *Delegate)
     return IsValid(World) && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE);
 }
 
-void UAppLovinMAXDelegate::BroadcastSdkInitializedEvent(const FSdkConfiguration &SdkConfiguration)
+namespace
+{
+    // Delegate components between BeginPlay and EndPlay. Only accessed on the game thread.
+    TArray<TWeakObjectPtr<UAppLovinMAXDelegate>> RegisteredDelegates;
+} // namespace
+
+// Broadcasts to the given dynamic delegate member of every registered delegate component. Must be called on the game thread.
+template <typename DelegateType, typename... ArgTypes>
+void BroadcastToDelegates(DelegateType UAppLovinMAXDelegate::*DelegateMember, const ArgTypes &...Args)
 {
-    AsyncTask(ENamedThreads::GameThread, [=]()
+    // Iterate over a copy since handlers may begin or end play on other delegate components
+    const TArray<TWeakObjectPtr<UAppLovinMAXDelegate>, TInlineAllocator<8>> Delegates(RegisteredDelegates);
+    for (const TWeakObjectPtr<UAppLovinMAXDelegate> &WeakDelegate : Delegates)
     {
-        for (TObjectIterator<UAppLovinMAXDelegate> Itr; Itr; ++Itr)
+        UAppLovinMAXDelegate *Delegate = WeakDelegate.Get();
+        if (IsValid(Delegate))
         {
-            if (IsValidDelegate(*Itr))
-            {
-                Itr->OnSdkInitializedDynamicDelegate.Broadcast(SdkConfiguration);
-            }
+            (Delegate->*DelegateMember).Broadcast(Args...);
         }
-    });
+    }
 }
 
-void UAppLovinMAXDelegate::BroadcastCmpCompletedEvent(const FCmpError &CmpError)
+// MARK: - UActorComponent
+
+void UAppLovinMAXDelegate::BeginPlay()
 {
-    AsyncTask(ENamedThreads::GameThread, [=]()
+    Super::BeginPlay();
+
+    if (IsValidDelegate(this))
     {
-        for (TObjectIterator<UAppLovinMAXDelegate> Itr; Itr; ++Itr)
-        {
-            if (IsValidDelegate(*Itr))
-            {
-                Itr->OnCmpCompletedDelegate.Broadcast(CmpError);
-            }
-        }
-    });
+        RegisteredDelegates.AddUnique(this);
+    }
 }
 
-void UAppLovinMAXDelegate::BroadcastAdEvent(const FString &Name, const FAdInfo &AdInfo)
+void UAppLovinMAXDelegate::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    AsyncTask(ENamedThreads::GameThread, [=]()
+    // Also drops entries for components that were garbage collected without ending play
+    RegisteredDelegates.RemoveAll([this](const TWeakObjectPtr<UAppLovinMAXDelegate> &WeakDelegate)
     {
-        for (TObjectIterator<UAppLovinMAXDelegate> Itr; Itr; ++Itr)
-        {
-            if (IsValidDelegate(*Itr))
-            {
-                if (Name == TEXT("OnBannerAdLoadedEvent"))
-                {
-                    Itr->OnBannerAdLoadedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnBannerAdClickedEvent"))
-                {
-                    Itr->OnBannerAdClickedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnBannerAdExpandedEvent"))
-                {
-                    Itr->OnBannerAdExpandedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnBannerAdCollapsedEvent"))
-                {
-                    Itr->OnBannerAdCollapsedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnBannerAdRevenuePaidEvent"))
-                {
-                    Itr->OnBannerAdRevenuePaidDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnMRecAdLoadedEvent"))
-                {
-                    Itr->OnMRecAdLoadedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnMRecAdClickedEvent"))
-                {
-                    Itr->OnMRecAdClickedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnMRecAdExpandedEvent"))
-                {
-                    Itr->OnMRecAdExpandedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnMRecAdCollapsedEvent"))
-                {
-                    Itr->OnMRecAdCollapsedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnMRecAdRevenuePaidEvent"))
-                {
-                    Itr->OnMRecAdRevenuePaidDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnInterstitialAdLoadedEvent"))
-                {
-                    Itr->OnInterstitialAdLoadedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnInterstitialAdDisplayedEvent"))
-                {
-                    Itr->OnInterstitialAdDisplayedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnInterstitialAdHiddenEvent"))
-                {
-                    Itr->OnInterstitialAdHiddenDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnInterstitialAdClickedEvent"))
-                {
-                    Itr->OnInterstitialAdClickedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnInterstitialAdRevenuePaidEvent"))
-                {
-                    Itr->OnInterstitialAdRevenuePaidDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnRewardedAdLoadedEvent"))
-                {
-                    Itr->OnRewardedAdLoadedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnRewardedAdDisplayedEvent"))
-                {
-                    Itr->OnRewardedAdDisplayedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnRewardedAdHiddenEvent"))
-                {
-                    Itr->OnRewardedAdHiddenDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnRewardedAdClickedEvent"))
-                {
-                    Itr->OnRewardedAdClickedDynamicDelegate.Broadcast(AdInfo);
-                }
-                else if (Name == TEXT("OnRewardedAdRevenuePaidEvent"))
-                {
-                    Itr->OnRewardedAdRevenuePaidDynamicDelegate.Broadcast(AdInfo);
-                }
-            }
-        }
+        return !WeakDelegate.IsValid() || WeakDelegate.Get() == this;
     });
+
+    Super::EndPlay(EndPlayReason);
 }
 
-void UAppLovinMAXDelegate::BroadcastAdErrorEvent(const FString &Name, const FAdInfo &AdInfo, const FAdError &AdError)
+// Broadcasts a queued event to the registered delegate components. Called on the game thread.
+void DispatchQueuedEvent(const FAppLovinMAXQueuedEvent &QueuedEvent)
 {
-    AsyncTask(ENamedThreads::GameThread, [=]()
+    MAX_TRACE_DYNAMIC_SCOPE(AppLovinMAXEvent::ToName(QueuedEvent.Event));
+
+    const double SecondsSinceNativeEvent = AppLovinMAXTrace::GetSecondsSinceNativeTimestamp(QueuedEvent.AdInfo.NativeTimestamp);
+    if (SecondsSinceNativeEvent >= 0.0)
     {
-        for (TObjectIterator<UAppLovinMAXDelegate> Itr; Itr; ++Itr)
-        {
-            if (IsValidDelegate(*Itr))
-            {
-                if (Name == TEXT("OnBannerAdLoadFailedEvent"))
-                {
-                    Itr->OnBannerAdLoadFailedDynamicDelegate.Broadcast(AdInfo, AdError);
-                }
-                else if (Name == TEXT("OnMRecAdLoadFailedEvent"))
-                {
-                    Itr->OnMRecAdLoadFailedDynamicDelegate.Broadcast(AdInfo, AdError);
-                }
-                else if (Name == TEXT("OnInterstitialAdLoadFailedEvent"))
-                {
-                    Itr->OnInterstitialAdLoadFailedDynamicDelegate.Broadcast(AdInfo, AdError);
-                }
-                else if (Name == TEXT("OnInterstitialAdDisplayFailedEvent"))
-                {
-                    Itr->OnInterstitialAdDisplayFailedDynamicDelegate.Broadcast(AdInfo, AdError);
-                }
-                else if (Name == TEXT("OnRewardedAdLoadFailedEvent"))
-                {
-                    Itr->OnRewardedAdLoadFailedDynamicDelegate.Broadcast(AdInfo, AdError);
-                }
-                else if (Name == TEXT("OnRewardedAdDisplayFailedEvent"))
-                {
-                    Itr->OnRewardedAdDisplayFailedDynamicDelegate.Broadcast(AdInfo, AdError);
-                }
-            }
-        }
-    });
+        TRACE_COUNTER_SET(AppLovinMAXDeliveryLatency, SecondsSinceNativeEvent * 1000.0);
+    }
+
+    switch (QueuedEvent.Event)
+    {
+        case EAppLovinMAXEvent::SdkInitialized:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnSdkInitializedDynamicDelegate, QueuedEvent.SdkConfiguration);
+            break;
+        case EAppLovinMAXEvent::CmpCompleted:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnCmpCompletedDelegate, QueuedEvent.CmpError);
+            break;
+        case EAppLovinMAXEvent::BannerAdLoaded:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnBannerAdLoadedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::BannerAdLoadFailed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnBannerAdLoadFailedDynamicDelegate, QueuedEvent.AdInfo, QueuedEvent.AdError);
+            break;
+        case EAppLovinMAXEvent::BannerAdClicked:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnBannerAdClickedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::BannerAdExpanded:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnBannerAdExpandedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::BannerAdCollapsed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnBannerAdCollapsedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::BannerAdRevenuePaid:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnBannerAdRevenuePaidDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::MRecAdLoaded:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnMRecAdLoadedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::MRecAdLoadFailed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnMRecAdLoadFailedDynamicDelegate, QueuedEvent.AdInfo, QueuedEvent.AdError);
+            break;
+        case EAppLovinMAXEvent::MRecAdClicked:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnMRecAdClickedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::MRecAdExpanded:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnMRecAdExpandedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::MRecAdCollapsed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnMRecAdCollapsedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::MRecAdRevenuePaid:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnMRecAdRevenuePaidDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::InterstitialAdLoaded:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnInterstitialAdLoadedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::InterstitialAdLoadFailed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnInterstitialAdLoadFailedDynamicDelegate, QueuedEvent.AdInfo, QueuedEvent.AdError);
+            break;
+        case EAppLovinMAXEvent::InterstitialAdDisplayed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnInterstitialAdDisplayedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::InterstitialAdDisplayFailed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnInterstitialAdDisplayFailedDynamicDelegate, QueuedEvent.AdInfo, QueuedEvent.AdError);
+            break;
+        case EAppLovinMAXEvent::InterstitialAdHidden:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnInterstitialAdHiddenDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::InterstitialAdClicked:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnInterstitialAdClickedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::InterstitialAdRevenuePaid:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnInterstitialAdRevenuePaidDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::RewardedAdLoaded:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnRewardedAdLoadedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::RewardedAdLoadFailed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnRewardedAdLoadFailedDynamicDelegate, QueuedEvent.AdInfo, QueuedEvent.AdError);
+            break;
+        case EAppLovinMAXEvent::RewardedAdDisplayed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnRewardedAdDisplayedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::RewardedAdDisplayFailed:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnRewardedAdDisplayFailedDynamicDelegate, QueuedEvent.AdInfo, QueuedEvent.AdError);
+            break;
+        case EAppLovinMAXEvent::RewardedAdHidden:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnRewardedAdHiddenDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::RewardedAdClicked:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnRewardedAdClickedDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::RewardedAdRevenuePaid:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnRewardedAdRevenuePaidDynamicDelegate, QueuedEvent.AdInfo);
+            break;
+        case EAppLovinMAXEvent::RewardedAdReceivedReward:
+            BroadcastToDelegates(&UAppLovinMAXDelegate::OnRewardedAdReceivedRewardDynamicDelegate, QueuedEvent.AdInfo, QueuedEvent.Reward);
+            break;
+        default:
+            break;
+    }
+}
+
+FAppLovinMAXEventQueue &GetEventQueue()
+{
+    static FAppLovinMAXEventQueue EventQueue(&DispatchQueuedEvent);
+    return EventQueue;
+}
+
+// MARK: - Broadcast Methods
+
+void UAppLovinMAXDelegate::BroadcastSdkInitializedEvent(const FSdkConfiguration &SdkConfiguration)
+{
+    FAppLovinMAXQueuedEvent QueuedEvent;
+    QueuedEvent.Event = EAppLovinMAXEvent::SdkInitialized;
+    QueuedEvent.SdkConfiguration = SdkConfiguration;
+    GetEventQueue().Enqueue(MoveTemp(QueuedEvent));
+}
+
+void UAppLovinMAXDelegate::BroadcastCmpCompletedEvent(const FCmpError &CmpError)
+{
+    FAppLovinMAXQueuedEvent QueuedEvent;
+    QueuedEvent.Event = EAppLovinMAXEvent::CmpCompleted;
+    QueuedEvent.CmpError = CmpError;
+    GetEventQueue().Enqueue(MoveTemp(QueuedEvent));
+}
+
+void UAppLovinMAXDelegate::BroadcastAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo)
+{
+    FAppLovinMAXQueuedEvent QueuedEvent;
+    QueuedEvent.Event = Event;
+    QueuedEvent.AdInfo = AdInfo;
+    GetEventQueue().Enqueue(MoveTemp(QueuedEvent));
+}
+
+void UAppLovinMAXDelegate::BroadcastAdErrorEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError)
+{
+    FAppLovinMAXQueuedEvent QueuedEvent;
+    QueuedEvent.Event = Event;
+    QueuedEvent.AdInfo = AdInfo;
+    QueuedEvent.AdError = AdError;
+    GetEventQueue().Enqueue(MoveTemp(QueuedEvent));
 }
 
 void UAppLovinMAXDelegate::BroadcastRewardedAdReceivedRewardEvent(const FAdInfo &AdInfo, const FAdReward &Reward)
 {
-    AsyncTask(ENamedThreads::GameThread, [=]()
+    FAppLovinMAXQueuedEvent QueuedEvent;
+    QueuedEvent.Event = EAppLovinMAXEvent::RewardedAdReceivedReward;
+    QueuedEvent.AdInfo = AdInfo;
+    QueuedEvent.Reward = Reward;
+    GetEventQueue().Enqueue(MoveTemp(QueuedEvent));
+}
+
+void UAppLovinMAXDelegate::BroadcastAdEvent(const FString &Name, const FAdInfo &AdInfo)
+{
+    const EAppLovinMAXEvent Event = AppLovinMAXEvent::FromName(Name);
+    if (Event == EAppLovinMAXEvent::Unknown)
     {
-        for (TObjectIterator<UAppLovinMAXDelegate> Itr; Itr; ++Itr)
-        {
-            Itr->OnRewardedAdReceivedRewardDynamicDelegate.Broadcast(AdInfo, Reward);
-        }
-    });
+        MAX_USER_WARN("Unknown MAX ad event fired: %s", *Name);
+        return;
+    }
+
+    BroadcastAdEvent(Event, AdInfo);
+}
+
+void UAppLovinMAXDelegate::BroadcastAdErrorEvent(const FString &Name, const FAdInfo &AdInfo, const FAdError &AdError)
+{
+    const EAppLovinMAXEvent Event = AppLovinMAXEvent::FromName(Name);
+    if (Event == EAppLovinMAXEvent::Unknown)
+    {
+        MAX_USER_WARN("Unknown MAX ad event fired: %s", *Name);
+        return;
+    }
+
+    BroadcastAdErrorEvent(Event, AdInfo, AdError);
+}
+
+// MARK: - Event Queue Counters
+
+int32 UAppLovinMAXDelegate::GetQueuedEventCount()
+{
+    return GetEventQueue().GetDepth();
 }
 
+double UAppLovinMAXDelegate::GetOldestQueuedEventAge()
+{
+    return GetEventQueue().GetOldestEventAge();
+}
+
+int32 UAppLovinMAXDelegate::GetPendingTaskCount()
+{
+    return GetEventQueue().GetPendingTaskCount();
+}
+
+int32 UAppLovinMAXDelegate::GetRegisteredDelegateCount()
+{
+    check(IsInGameThread());
+    return RegisteredDelegates.Num();
+}
@@ -0,0 +1,88 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXEvent.h"
+
+namespace
+{
+    // NOTE: Names must match the event names sent by MaxUnrealPlugin.java and MAUnrealPlugin.mm, and be in the same order as EAppLovinMAXEvent
+    const TCHAR *const EventNames[] = {
+        TEXT("OnSdkInitializedEvent"),
+        TEXT("OnCmpCompletedEvent"),
+
+        TEXT("OnBannerAdLoadedEvent"),
+        TEXT("OnBannerAdLoadFailedEvent"),
+        TEXT("OnBannerAdClickedEvent"),
+        TEXT("OnBannerAdExpandedEvent"),
+        TEXT("OnBannerAdCollapsedEvent"),
+        TEXT("OnBannerAdRevenuePaidEvent"),
+
+        TEXT("OnMRecAdLoadedEvent"),
+        TEXT("OnMRecAdLoadFailedEvent"),
+        TEXT("OnMRecAdClickedEvent"),
+        TEXT("OnMRecAdExpandedEvent"),
+        TEXT("OnMRecAdCollapsedEvent"),
+        TEXT("OnMRecAdRevenuePaidEvent"),
+
+        TEXT("OnInterstitialAdLoadedEvent"),
+        TEXT("OnInterstitialAdLoadFailedEvent"),
+        TEXT("OnInterstitialAdDisplayedEvent"),
+        TEXT("OnInterstitialAdDisplayFailedEvent"),
+        TEXT("OnInterstitialAdHiddenEvent"),
+        TEXT("OnInterstitialAdClickedEvent"),
+        TEXT("OnInterstitialAdRevenuePaidEvent"),
+
+        TEXT("OnRewardedAdLoadedEvent"),
+        TEXT("OnRewardedAdLoadFailedEvent"),
+        TEXT("OnRewardedAdDisplayedEvent"),
+        TEXT("OnRewardedAdDisplayFailedEvent"),
+        TEXT("OnRewardedAdHiddenEvent"),
+        TEXT("OnRewardedAdClickedEvent"),
+        TEXT("OnRewardedAdRevenuePaidEvent"),
+        TEXT("OnRewardedAdReceivedRewardEvent"),
+    };
+
+    static_assert(UE_ARRAY_COUNT(EventNames) == (int32)EAppLovinMAXEvent::Count, "EventNames must have an entry for every EAppLovinMAXEvent");
+
+    const TMap<FString, EAppLovinMAXEvent> &GetEventRegistry()
+    {
+        // Built once on first use; function-local statics are initialized thread-safely
+        static const TMap<FString, EAppLovinMAXEvent> Registry = []()
+        {
+            TMap<FString, EAppLovinMAXEvent> Result;
+            Result.Reserve(UE_ARRAY_COUNT(EventNames));
+            for (int32 Index = 0; Index < UE_ARRAY_COUNT(EventNames); Index++)
+            {
+                Result.Add(EventNames[Index], (EAppLovinMAXEvent)Index);
+            }
+            return Result;
+        }();
+        return Registry;
+    }
+} // namespace
+
+EAppLovinMAXEvent AppLovinMAXEvent::FromName(const FString &Name)
+{
+    const EAppLovinMAXEvent *Event = GetEventRegistry().Find(Name);
+    return Event ? *Event : EAppLovinMAXEvent::Unknown;
+}
+
+const TCHAR *AppLovinMAXEvent::ToName(EAppLovinMAXEvent Event)
+{
+    return Event < EAppLovinMAXEvent::Count ? EventNames[(int32)Event] : TEXT("Unknown");
+}
+
+bool AppLovinMAXEvent::IsAdErrorEvent(EAppLovinMAXEvent Event)
+{
+    switch (Event)
+    {
+        case EAppLovinMAXEvent::BannerAdLoadFailed:
+        case EAppLovinMAXEvent::MRecAdLoadFailed:
+        case EAppLovinMAXEvent::InterstitialAdLoadFailed:
+        case EAppLovinMAXEvent::InterstitialAdDisplayFailed:
+        case EAppLovinMAXEvent::RewardedAdLoadFailed:
+        case EAppLovinMAXEvent::RewardedAdDisplayFailed:
+            return true;
+        default:
+            return false;
+    }
+}
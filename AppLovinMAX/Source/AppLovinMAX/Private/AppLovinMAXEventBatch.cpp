@@ -0,0 +1,104 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXEventBatch.h"
+#include "AppLovinMAXUtils.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    // Enough for a few dozen events with parameters, so that typical batches never grow the buffers
+    constexpr int32 InitialBufferCapacity = 8 * 1024;
+} // namespace
+
+FAppLovinMAXEventBatch::FAppLovinMAXEventBatch(FFlushCallback &&InFlushCallback)
+    : FlushCallback(MoveTemp(InFlushCallback))
+{
+    PendingEvents.Reserve(InitialBufferCapacity);
+    SendingEvents.Reserve(InitialBufferCapacity);
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAppLovinMAXEventBatch::Tick));
+
+    // The app may be killed while in the background, so buffered events are sent before that can happen
+    EnterBackgroundHandle = FCoreDelegates::ApplicationWillEnterBackgroundDelegate.AddRaw(this, &FAppLovinMAXEventBatch::Flush);
+}
+
+FAppLovinMAXEventBatch::~FAppLovinMAXEventBatch()
+{
+    FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(EnterBackgroundHandle);
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+void FAppLovinMAXEventBatch::SetLimits(int32 InMaxBatchSize, double InMaxBatchDelay)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    MaxBatchSize = FMath::Max(1, InMaxBatchSize);
+    MaxBatchDelay = FMath::Max(0.0, InMaxBatchDelay);
+}
+
+void FAppLovinMAXEventBatch::Add(const FString &Name, const TMap<FString, FString> &Parameters)
+{
+    bool bShouldFlush;
+    {
+        FScopeLock ScopeLock(&Lock);
+
+        if (PendingEventCount == 0)
+        {
+            FirstPendingEventTime = FPlatformTime::Seconds();
+            PendingEvents.AppendChar(TEXT('['));
+        }
+        else
+        {
+            PendingEvents.AppendChar(TEXT(','));
+        }
+
+        PendingEvents += TEXT("{\"name\":");
+        AppLovinMAXUtils::AppendJsonString(PendingEvents, Name);
+        PendingEvents += TEXT(",\"parameters\":");
+        AppLovinMAXUtils::AppendSerializedMap(PendingEvents, Parameters);
+        PendingEvents.AppendChar(TEXT('}'));
+
+        PendingEventCount++;
+        bShouldFlush = PendingEventCount >= MaxBatchSize;
+    }
+
+    if (bShouldFlush)
+    {
+        Flush();
+    }
+}
+
+void FAppLovinMAXEventBatch::Flush()
+{
+    FScopeLock FlushScopeLock(&FlushLock);
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (PendingEventCount == 0) return;
+
+        PendingEvents.AppendChar(TEXT(']'));
+
+        // Swap rather than copy so that both buffers keep their capacity and new events can be added while this batch is sent
+        Swap(PendingEvents, SendingEvents);
+        PendingEvents.Reset();
+        PendingEventCount = 0;
+    }
+
+    FlushCallback(SendingEvents);
+}
+
+bool FAppLovinMAXEventBatch::Tick(float DeltaTime)
+{
+    bool bShouldFlush;
+    {
+        FScopeLock ScopeLock(&Lock);
+        bShouldFlush = PendingEventCount > 0 && FPlatformTime::Seconds() - FirstPendingEventTime >= MaxBatchDelay;
+    }
+
+    if (bShouldFlush)
+    {
+        Flush();
+    }
+
+    return true;
+}
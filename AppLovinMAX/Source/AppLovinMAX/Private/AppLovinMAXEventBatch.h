@@ -0,0 +1,52 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Buffers tracked events as a JSON array and hands them to the flush callback in one call, instead of one native call per event.
+ * Events are serialized straight into a reserved buffer as they are added. The buffer is flushed on the next frame once the
+ * max batch delay has passed, as soon as the max batch size is reached, and when the app enters the background.
+ */
+class FAppLovinMAXEventBatch
+{
+public:
+    /** Receives a JSON array of {"name": ..., "parameters": {...}} objects. */
+    using FFlushCallback = TFunction<void(const FString &SerializedEvents)>;
+
+    explicit FAppLovinMAXEventBatch(FFlushCallback &&InFlushCallback);
+    ~FAppLovinMAXEventBatch();
+
+    /**
+     * @param InMaxBatchSize - Number of buffered events that triggers an immediate flush
+     * @param InMaxBatchDelay - Seconds an event may stay buffered before it is flushed on the next frame. 0 flushes every frame.
+     */
+    void SetLimits(int32 InMaxBatchSize, double InMaxBatchDelay);
+
+    /** Can be called from any thread. */
+    void Add(const FString &Name, const TMap<FString, FString> &Parameters);
+
+    /** Sends all buffered events to the flush callback. Can be called from any thread. */
+    void Flush();
+
+private:
+    bool Tick(float DeltaTime);
+
+    FFlushCallback FlushCallback;
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle EnterBackgroundHandle;
+
+    // Guards the pending events and limits
+    FCriticalSection Lock;
+    FString PendingEvents;
+    int32 PendingEventCount = 0;
+    double FirstPendingEventTime = 0.0;
+    int32 MaxBatchSize = 64;
+    double MaxBatchDelay = 0.0;
+
+    // Serializes flushes and guards the buffer being sent. Always taken before Lock.
+    FCriticalSection FlushLock;
+    FString SendingEvents;
+};
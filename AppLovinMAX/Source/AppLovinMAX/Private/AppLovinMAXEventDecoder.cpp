@@ -0,0 +1,636 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXEventDecoder.h"
+#include "AppLovinMAXStats.h"
+
+namespace
+{
+    /** Forward-only reader over the top-level members of a flat JSON object. */
+    class FFlatJsonReader
+    {
+    public:
+        explicit FFlatJsonReader(const FString &Json)
+            : Current(*Json), End(*Json + Json.Len())
+        {
+        }
+
+        /** Advances to the next member and returns its key. Returns false at the end of the object or if the input is malformed. */
+        bool NextKey(FStringView &OutKey)
+        {
+            SkipWhitespace();
+            if (!bStarted)
+            {
+                bStarted = true;
+                if (!Consume(TEXT('{'))) return Fail();
+
+                SkipWhitespace();
+                if (Consume(TEXT('}'))) return false;
+            }
+            else if (!Consume(TEXT(',')))
+            {
+                if (!Consume(TEXT('}'))) Fail();
+                return false;
+            }
+
+            SkipWhitespace();
+            if (!Consume(TEXT('"'))) return Fail();
+
+            const TCHAR *KeyStart = Current;
+            while (Current < End && *Current != TEXT('"'))
+            {
+                // Keys sent by the native plugins never contain escapes, but step over them so the key boundary is found correctly
+                Current += (*Current == TEXT('\\') && Current + 1 < End) ? 2 : 1;
+            }
+            if (Current >= End) return Fail();
+
+            OutKey = FStringView(KeyStart, UE_PTRDIFF_TO_INT32(Current - KeyStart));
+            Current++;
+
+            SkipWhitespace();
+            if (!Consume(TEXT(':'))) return Fail();
+
+            SkipWhitespace();
+            return true;
+        }
+
+        /** Reads a string value into Out. A null value yields an empty string. Any other type is skipped and leaves Out untouched. */
+        void ReadString(FString &Out)
+        {
+            if (ConsumeLiteral(TEXT("null")))
+            {
+                Out.Reset();
+                return;
+            }
+
+            if (!Consume(TEXT('"')))
+            {
+                SkipValue();
+                return;
+            }
+
+            Out.Reset();
+
+            const TCHAR *RunStart = Current;
+            while (Current < End)
+            {
+                const TCHAR Char = *Current;
+                if (Char == TEXT('"'))
+                {
+                    Out.AppendChars(RunStart, UE_PTRDIFF_TO_INT32(Current - RunStart));
+                    Current++;
+                    return;
+                }
+
+                if (Char != TEXT('\\'))
+                {
+                    Current++;
+                    continue;
+                }
+
+                // Copy the unescaped run in one go, then decode the escape sequence
+                Out.AppendChars(RunStart, UE_PTRDIFF_TO_INT32(Current - RunStart));
+                Current++;
+                if (Current >= End) break;
+
+                const TCHAR Escaped = *Current++;
+                switch (Escaped)
+                {
+                    case TEXT('b'): Out.AppendChar(TEXT('\b')); break;
+                    case TEXT('f'): Out.AppendChar(TEXT('\f')); break;
+                    case TEXT('n'): Out.AppendChar(TEXT('\n')); break;
+                    case TEXT('r'): Out.AppendChar(TEXT('\r')); break;
+                    case TEXT('t'): Out.AppendChar(TEXT('\t')); break;
+                    case TEXT('u'):
+                    {
+                        uint32 CodeUnit;
+                        if (!ReadHex4(CodeUnit)) return (void)Fail();
+                        AppendCodeUnit(Out, CodeUnit);
+                        break;
+                    }
+                    default: Out.AppendChar(Escaped); break; // '"', '\\' and '/'
+                }
+
+                RunStart = Current;
+            }
+
+            Fail();
+        }
+
+        /** Reads a numeric value. Any other type is skipped and leaves Out untouched. */
+        void ReadDouble(double &Out)
+        {
+            TCHAR Buffer[64];
+            if (ReadNumber(Buffer, UE_ARRAY_COUNT(Buffer)))
+            {
+                Out = FCString::Atod(Buffer);
+            }
+        }
+
+        /** Reads an integer value. Fractional values are truncated. Any other type is skipped and leaves Out untouched. */
+        void ReadInt(int32 &Out)
+        {
+            double Value = Out;
+            ReadDouble(Value);
+            Out = (int32)Value;
+        }
+
+        /** Reads a boolean value. Any other type is skipped and leaves Out untouched. */
+        void ReadBool(bool &Out)
+        {
+            if (ConsumeLiteral(TEXT("true")))
+            {
+                Out = true;
+            }
+            else if (ConsumeLiteral(TEXT("false")))
+            {
+                Out = false;
+            }
+            else
+            {
+                double Value = Out ? 1 : 0;
+                ReadDouble(Value);
+                Out = Value != 0;
+            }
+        }
+
+        /** Skips over the current value, including nested objects and arrays. */
+        void SkipValue()
+        {
+            int32 Depth = 0;
+            while (Current < End)
+            {
+                const TCHAR Char = *Current;
+                if (Depth == 0 && (Char == TEXT(',') || Char == TEXT('}') || Char == TEXT(']'))) return;
+
+                Current++;
+                if (Char == TEXT('"'))
+                {
+                    SkipStringBody();
+                }
+                else if (Char == TEXT('{') || Char == TEXT('['))
+                {
+                    Depth++;
+                }
+                else if (Char == TEXT('}') || Char == TEXT(']'))
+                {
+                    Depth--;
+                }
+            }
+        }
+
+        bool HasError() const { return bError; }
+
+    private:
+        // Advances past the closing quote of a string whose opening quote has already been consumed
+        void SkipStringBody()
+        {
+            while (Current < End && *Current != TEXT('"'))
+            {
+                Current += (*Current == TEXT('\\') && Current + 1 < End) ? 2 : 1;
+            }
+            if (Current < End) Current++;
+        }
+
+        void SkipWhitespace()
+        {
+            while (Current < End && (*Current == TEXT(' ') || *Current == TEXT('\t') || *Current == TEXT('\n') || *Current == TEXT('\r')))
+            {
+                Current++;
+            }
+        }
+
+        bool Consume(TCHAR Char)
+        {
+            if (Current < End && *Current == Char)
+            {
+                Current++;
+                return true;
+            }
+            return false;
+        }
+
+        bool ConsumeLiteral(const TCHAR *Literal)
+        {
+            const int32 Length = FCString::Strlen(Literal);
+            if (End - Current >= Length && FCString::Strncmp(Current, Literal, Length) == 0)
+            {
+                Current += Length;
+                return true;
+            }
+            return false;
+        }
+
+        bool ReadNumber(TCHAR *Buffer, int32 BufferSize)
+        {
+            int32 Length = 0;
+            while (Current < End && Length < BufferSize - 1)
+            {
+                const TCHAR Char = *Current;
+                if (!FChar::IsDigit(Char) && Char != TEXT('-') && Char != TEXT('+') && Char != TEXT('.') && Char != TEXT('e') && Char != TEXT('E')) break;
+
+                Buffer[Length++] = Char;
+                Current++;
+            }
+            Buffer[Length] = TEXT('\0');
+
+            if (Length == 0)
+            {
+                SkipValue();
+                return false;
+            }
+            return true;
+        }
+
+        bool ReadHex4(uint32 &OutValue)
+        {
+            if (End - Current < 4) return false;
+
+            OutValue = 0;
+            for (int32 Index = 0; Index < 4; Index++)
+            {
+                const TCHAR Char = *Current++;
+                if (!FChar::IsHexDigit(Char)) return false;
+                OutValue = (OutValue << 4) | FParse::HexDigit(Char);
+            }
+            return true;
+        }
+
+        void AppendCodeUnit(FString &Out, uint32 CodeUnit)
+        {
+            // UTF-16 platforms store surrogate pairs as-is; UTF-32 platforms need them combined into a single code point
+            if (sizeof(TCHAR) == 4 && CodeUnit >= 0xD800 && CodeUnit <= 0xDBFF && End - Current >= 6 && Current[0] == TEXT('\\') && Current[1] == TEXT('u'))
+            {
+                const TCHAR *Checkpoint = Current;
+                Current += 2;
+
+                uint32 LowSurrogate;
+                if (ReadHex4(LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+                {
+                    Out.AppendChar((TCHAR)(0x10000 + ((CodeUnit - 0xD800) << 10) + (LowSurrogate - 0xDC00)));
+                    return;
+                }
+
+                Current = Checkpoint;
+            }
+
+            Out.AppendChar((TCHAR)CodeUnit);
+        }
+
+        bool Fail()
+        {
+            bError = true;
+            Current = End;
+            return false;
+        }
+
+        const TCHAR *Current;
+        const TCHAR *End;
+        bool bStarted = false;
+        bool bError = false;
+    };
+
+    bool KeyEquals(const FStringView &Key, const TCHAR *Expected)
+    {
+        return Key.Equals(Expected, ESearchCase::IgnoreCase);
+    }
+
+    // NOTE: Must match MaxUnrealPlugin.BinaryEventWriter
+    constexpr uint8 BinaryFormatVersion = 1;
+
+    // Each tag byte is (field << 2) | type, so fields added in later versions can be skipped by type
+    enum class EBinaryFieldType : uint8
+    {
+        String = 0,
+        Double = 1,
+        Int32 = 2
+    };
+
+    enum class EBinaryField : uint8
+    {
+        End = 0,
+        AdUnitIdentifier = 1,
+        NetworkName = 2,
+        CreativeIdentifier = 3,
+        Placement = 4,
+        Revenue = 5,
+        ErrorCode = 6,
+        ErrorMessage = 7,
+        ErrorWaterfall = 8,
+        RewardLabel = 9,
+        RewardAmount = 10,
+        Timestamp = 11,
+        ErrorWaterfallData = 12,
+        AdUnitHandle = 13
+    };
+
+    /** Bounds-checked reader over a little-endian binary event body. */
+    class FBinaryEventReader
+    {
+    public:
+        FBinaryEventReader(const uint8 *InData, int32 InLength)
+            : Current(InData), End(InData + FMath::Max(InLength, 0))
+        {
+        }
+
+        bool ReadByte(uint8 &Out)
+        {
+            if (End - Current < 1) return Fail();
+            Out = *Current++;
+            return true;
+        }
+
+        bool ReadInt32(int32 &Out)
+        {
+            uint32 Value;
+            if (!ReadBytes(&Value, sizeof(Value))) return false;
+            Out = (int32)INTEL_ORDER32(Value);
+            return true;
+        }
+
+        bool ReadDouble(double &Out)
+        {
+            uint64 Value;
+            if (!ReadBytes(&Value, sizeof(Value))) return false;
+            Value = INTEL_ORDER64(Value);
+            FMemory::Memcpy(&Out, &Value, sizeof(Out));
+            return true;
+        }
+
+        bool ReadString(FString &Out)
+        {
+            int32 ByteCount;
+            if (!ReadInt32(ByteCount) || ByteCount < 0 || End - Current < ByteCount) return Fail();
+
+            const FUTF8ToTCHAR Converted((const ANSICHAR *)Current, ByteCount);
+            Out.Reset(Converted.Length());
+            Out.AppendChars(Converted.Get(), Converted.Length());
+
+            Current += ByteCount;
+            return true;
+        }
+
+        bool SkipValue(EBinaryFieldType Type)
+        {
+            switch (Type)
+            {
+                case EBinaryFieldType::String:
+                {
+                    int32 ByteCount;
+                    if (!ReadInt32(ByteCount) || ByteCount < 0 || End - Current < ByteCount) return Fail();
+                    Current += ByteCount;
+                    return true;
+                }
+                case EBinaryFieldType::Double:
+                {
+                    double Ignored;
+                    return ReadDouble(Ignored);
+                }
+                case EBinaryFieldType::Int32:
+                {
+                    int32 Ignored;
+                    return ReadInt32(Ignored);
+                }
+                default:
+                    return Fail();
+            }
+        }
+
+    private:
+        bool ReadBytes(void *Out, int32 Count)
+        {
+            if (End - Current < Count) return Fail();
+            FMemory::Memcpy(Out, Current, Count);
+            Current += Count;
+            return true;
+        }
+
+        bool Fail()
+        {
+            Current = End;
+            return false;
+        }
+
+        const uint8 *Current;
+        const uint8 *End;
+    };
+} // namespace
+
+bool AppLovinMAXEventDecoder::DecodeAdEvent(const FString &Body, FAdInfo &OutAdInfo, FAdError *OutAdError, FAdReward *OutReward)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AppLovinMAX_DecodeEvent);
+    MAX_CSV_SCOPED_TIME(DecodeTime);
+
+    FFlatJsonReader Reader(Body);
+    FStringView Key;
+    while (Reader.NextKey(Key))
+    {
+        if (KeyEquals(Key, TEXT("adUnitIdentifier")))
+        {
+            Reader.ReadString(OutAdInfo.AdUnitIdentifier);
+        }
+        else if (KeyEquals(Key, TEXT("networkName")))
+        {
+            Reader.ReadString(OutAdInfo.NetworkName);
+        }
+        else if (KeyEquals(Key, TEXT("creativeIdentifier")))
+        {
+            Reader.ReadString(OutAdInfo.CreativeIdentifier);
+        }
+        else if (KeyEquals(Key, TEXT("placement")))
+        {
+            Reader.ReadString(OutAdInfo.Placement);
+        }
+        else if (KeyEquals(Key, TEXT("revenue")))
+        {
+            Reader.ReadDouble(OutAdInfo.Revenue);
+        }
+        else if (KeyEquals(Key, TEXT("timestamp")))
+        {
+            Reader.ReadDouble(OutAdInfo.NativeTimestamp);
+        }
+        else if (KeyEquals(Key, TEXT("adUnitHandle")))
+        {
+            Reader.ReadInt(OutAdInfo.AdUnitHandle.Index);
+        }
+        else if (OutAdError && KeyEquals(Key, TEXT("code")))
+        {
+            Reader.ReadInt(OutAdError->Code);
+        }
+        else if (OutAdError && KeyEquals(Key, TEXT("message")))
+        {
+            Reader.ReadString(OutAdError->Message);
+        }
+        else if (OutAdError && (KeyEquals(Key, TEXT("waterfallData")) || KeyEquals(Key, TEXT("waterfall"))))
+        {
+            // Kept as sent and only parsed if the waterfall is read; "waterfall" is the description sent by older iOS plugins
+            Reader.ReadString(OutAdError->WaterfallPayload);
+        }
+        else if (OutReward && KeyEquals(Key, TEXT("label")))
+        {
+            Reader.ReadString(OutReward->Label);
+        }
+        else if (OutReward && KeyEquals(Key, TEXT("amount")))
+        {
+            Reader.ReadInt(OutReward->Amount);
+        }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+
+    return !Reader.HasError();
+}
+
+bool AppLovinMAXEventDecoder::DecodeBinaryAdEvent(const uint8 *Data, int32 Length, FAdInfo &OutAdInfo, FAdError *OutAdError, FAdReward *OutReward)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AppLovinMAX_DecodeEvent);
+    MAX_CSV_SCOPED_TIME(DecodeTime);
+
+    FBinaryEventReader Reader(Data, Length);
+
+    uint8 Version;
+    if (!Reader.ReadByte(Version) || Version != BinaryFormatVersion) return false;
+
+    int32 IgnoredInt;
+
+    uint8 Tag;
+    while (Reader.ReadByte(Tag))
+    {
+        const EBinaryField Field = (EBinaryField)(Tag >> 2);
+        const EBinaryFieldType Type = (EBinaryFieldType)(Tag & 0x3);
+
+        // A known field with another type than it is written with means the body is corrupt, so the event is rejected
+        bool bSuccess;
+        switch (Field)
+        {
+            case EBinaryField::End:
+                return true;
+            case EBinaryField::AdUnitIdentifier:
+                bSuccess = Type == EBinaryFieldType::String && Reader.ReadString(OutAdInfo.AdUnitIdentifier);
+                break;
+            case EBinaryField::NetworkName:
+                bSuccess = Type == EBinaryFieldType::String && Reader.ReadString(OutAdInfo.NetworkName);
+                break;
+            case EBinaryField::CreativeIdentifier:
+                bSuccess = Type == EBinaryFieldType::String && Reader.ReadString(OutAdInfo.CreativeIdentifier);
+                break;
+            case EBinaryField::Placement:
+                bSuccess = Type == EBinaryFieldType::String && Reader.ReadString(OutAdInfo.Placement);
+                break;
+            case EBinaryField::Revenue:
+                bSuccess = Type == EBinaryFieldType::Double && Reader.ReadDouble(OutAdInfo.Revenue);
+                break;
+            case EBinaryField::ErrorCode:
+                bSuccess = Type == EBinaryFieldType::Int32 && Reader.ReadInt32(OutAdError ? OutAdError->Code : IgnoredInt);
+                break;
+            case EBinaryField::ErrorMessage:
+                bSuccess = Type == EBinaryFieldType::String && (OutAdError ? Reader.ReadString(OutAdError->Message) : Reader.SkipValue(Type));
+                break;
+            case EBinaryField::ErrorWaterfall:
+            case EBinaryField::ErrorWaterfallData:
+                bSuccess = Type == EBinaryFieldType::String && (OutAdError ? Reader.ReadString(OutAdError->WaterfallPayload) : Reader.SkipValue(Type));
+                break;
+            case EBinaryField::RewardLabel:
+                bSuccess = Type == EBinaryFieldType::String && (OutReward ? Reader.ReadString(OutReward->Label) : Reader.SkipValue(Type));
+                break;
+            case EBinaryField::RewardAmount:
+                bSuccess = Type == EBinaryFieldType::Int32 && Reader.ReadInt32(OutReward ? OutReward->Amount : IgnoredInt);
+                break;
+            case EBinaryField::Timestamp:
+                bSuccess = Type == EBinaryFieldType::Double && Reader.ReadDouble(OutAdInfo.NativeTimestamp);
+                break;
+            case EBinaryField::AdUnitHandle:
+                bSuccess = Type == EBinaryFieldType::Int32 && Reader.ReadInt32(OutAdInfo.AdUnitHandle.Index);
+                break;
+            default:
+                bSuccess = Reader.SkipValue(Type);
+                break;
+        }
+
+        if (!bSuccess) return false;
+    }
+
+    // Missing end tag
+    return false;
+}
+
+bool AppLovinMAXEventDecoder::DecodeSdkConfiguration(const FString &Body, FSdkConfiguration &OutSdkConfiguration)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AppLovinMAX_DecodeEvent);
+    MAX_CSV_SCOPED_TIME(DecodeTime);
+
+    FFlatJsonReader Reader(Body);
+    FStringView Key;
+    while (Reader.NextKey(Key))
+    {
+        if (KeyEquals(Key, TEXT("consentFlowUserGeography")))
+        {
+            int32 Value = (int32)OutSdkConfiguration.ConsentFlowUserGeography;
+            Reader.ReadInt(Value);
+            OutSdkConfiguration.ConsentFlowUserGeography = (EConsentFlowUserGeography)Value;
+        }
+        else if (KeyEquals(Key, TEXT("countryCode")))
+        {
+            Reader.ReadString(OutSdkConfiguration.CountryCode);
+        }
+        else if (KeyEquals(Key, TEXT("hasUserConsent")))
+        {
+            Reader.ReadBool(OutSdkConfiguration.HasUserConsent);
+        }
+        else if (KeyEquals(Key, TEXT("isDoNotSell")))
+        {
+            Reader.ReadBool(OutSdkConfiguration.IsDoNotSell);
+        }
+        else if (KeyEquals(Key, TEXT("isTablet")))
+        {
+            Reader.ReadBool(OutSdkConfiguration.IsTablet);
+        }
+        else if (KeyEquals(Key, TEXT("appTrackingStatus")))
+        {
+            int32 Value = (int32)OutSdkConfiguration.AppTrackingStatus;
+            Reader.ReadInt(Value);
+            OutSdkConfiguration.AppTrackingStatus = (EAppTrackingStatus)Value;
+        }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+
+    return !Reader.HasError();
+}
+
+bool AppLovinMAXEventDecoder::DecodeCmpError(const FString &Body, FCmpError &OutCmpError)
+{
+    SCOPE_CYCLE_COUNTER(STAT_AppLovinMAX_DecodeEvent);
+    MAX_CSV_SCOPED_TIME(DecodeTime);
+
+    FFlatJsonReader Reader(Body);
+    FStringView Key;
+    while (Reader.NextKey(Key))
+    {
+        if (KeyEquals(Key, TEXT("code")))
+        {
+            Reader.ReadInt(OutCmpError.Code);
+        }
+        else if (KeyEquals(Key, TEXT("message")))
+        {
+            Reader.ReadString(OutCmpError.Message);
+        }
+        else if (KeyEquals(Key, TEXT("cmpCode")))
+        {
+            Reader.ReadInt(OutCmpError.CmpCode);
+        }
+        else if (KeyEquals(Key, TEXT("cmpMessage")))
+        {
+            Reader.ReadString(OutCmpError.CmpMessage);
+        }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+
+    return !Reader.HasError();
+}
@@ -0,0 +1,37 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdError.h"
+#include "AdInfo.h"
+#include "AdReward.h"
+#include "CmpError.h"
+#include "SdkConfiguration.h"
+
+/**
+ * Decodes the flat JSON event bodies sent by the native plugins directly into their USTRUCTs.
+ * Each body is scanned once without building an FJsonObject or reflecting over UPROPERTYs; unknown keys and nested values are skipped.
+ */
+namespace AppLovinMAXEventDecoder
+{
+    /**
+     * Decodes an ad event body. The ad error and reward are only decoded when requested.
+     * @return False if the body is not a well-formed JSON object. Fields decoded before the error are kept.
+     */
+    bool DecodeAdEvent(const FString &Body, FAdInfo &OutAdInfo, FAdError *OutAdError = nullptr, FAdReward *OutReward = nullptr);
+
+    /**
+     * Decodes an ad event body in the binary format written by MaxUnrealPlugin.BinaryEventWriter on Android:
+     * a version byte, then a sequence of (uint8 tag, value) fields terminated by a zero tag.
+     * Strings are an int32 byte count followed by UTF-8 bytes, and all numbers are little-endian.
+     * @return False if the version is unsupported or the buffer is truncated. Fields decoded before the error are kept.
+     */
+    bool DecodeBinaryAdEvent(const uint8 *Data, int32 Length, FAdInfo &OutAdInfo, FAdError *OutAdError = nullptr, FAdReward *OutReward = nullptr);
+
+    /** Decodes the body of OnSdkInitializedEvent. */
+    bool DecodeSdkConfiguration(const FString &Body, FSdkConfiguration &OutSdkConfiguration);
+
+    /** Decodes the body of OnCmpCompletedEvent. */
+    bool DecodeCmpError(const FString &Body, FCmpError &OutCmpError);
+} // namespace AppLovinMAXEventDecoder
@@ -0,0 +1,80 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXEventQueue.h"
+#include "AppLovinMAXTrace.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+
+FAppLovinMAXEventQueue::FAppLovinMAXEventQueue(FHandler InHandler, ENamedThreads::Type InThread)
+    : Handler(MoveTemp(InHandler)), Thread(InThread)
+{
+}
+
+void FAppLovinMAXEventQueue::Enqueue(FAppLovinMAXQueuedEvent &&Event)
+{
+    MAX_TRACE_SCOPE("AppLovinMAX::EnqueueEvent");
+
+    Event.EnqueueTime = FPlatformTime::Seconds();
+    Queue.Enqueue(MoveTemp(Event));
+    Depth.fetch_add(1);
+
+    // Only the first event since the last drain posts a task; later ones ride along with it
+    if (!bIsDrainScheduled.exchange(true))
+    {
+        ScheduleDrain();
+    }
+}
+
+int32 FAppLovinMAXEventQueue::GetDepth() const
+{
+    return Depth.load(std::memory_order_relaxed);
+}
+
+int32 FAppLovinMAXEventQueue::GetPendingTaskCount() const
+{
+    return bIsDrainScheduled.load(std::memory_order_relaxed) ? 1 : 0;
+}
+
+double FAppLovinMAXEventQueue::GetOldestEventAge() const
+{
+    check(Thread != ENamedThreads::GameThread || IsInGameThread());
+
+    const FAppLovinMAXQueuedEvent *Oldest = Queue.Peek();
+    return Oldest ? FPlatformTime::Seconds() - Oldest->EnqueueTime : 0.0;
+}
+
+void FAppLovinMAXEventQueue::ScheduleDrain()
+{
+    MAX_TRACE_SCOPE("AppLovinMAX::ScheduleDrain");
+    AsyncTask(Thread, [this]()
+    {
+        Drain();
+    });
+}
+
+void FAppLovinMAXEventQueue::Drain()
+{
+    check(Thread != ENamedThreads::GameThread || IsInGameThread());
+    MAX_TRACE_SCOPE("AppLovinMAX::DrainEventQueue");
+    SCOPE_CYCLE_COUNTER(STAT_AppLovinMAX_BroadcastEvents);
+    CSV_SCOPED_TIMING_STAT(AppLovinMAX, BroadcastEvents);
+
+    // The flag stays set while draining, so no other drain can be posted and this is the queue's only consumer.
+    // Events queued mid-drain are picked up by this loop.
+    FAppLovinMAXQueuedEvent Event;
+    while (Queue.Dequeue(Event))
+    {
+        Depth.fetch_sub(1);
+        TRACE_COUNTER_SET(AppLovinMAXQueueLatency, (FPlatformTime::Seconds() - Event.EnqueueTime) * 1000.0);
+        Handler(Event);
+    }
+
+    bIsDrainScheduled.store(false);
+
+    // An event queued after the last dequeue but before the flag was cleared saw the flag set and did not post a drain. Depth is checked rather than
+    // the queue itself, since a drain posted by a newer event may already be consuming it. Producers count an event before reading the flag.
+    if (Depth.load() > 0 && !bIsDrainScheduled.exchange(true))
+    {
+        ScheduleDrain();
+    }
+}
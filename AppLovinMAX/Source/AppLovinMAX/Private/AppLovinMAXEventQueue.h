@@ -0,0 +1,66 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdError.h"
+#include "AdInfo.h"
+#include "AdReward.h"
+#include "AppLovinMAXEvent.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "CmpError.h"
+#include "Containers/Queue.h"
+#include "SdkConfiguration.h"
+#include <atomic>
+
+/** A decoded event waiting to be broadcast on another thread. Only the payload for its event is set. */
+struct FAppLovinMAXQueuedEvent
+{
+    EAppLovinMAXEvent Event = EAppLovinMAXEvent::Unknown;
+    FAdInfo AdInfo;
+    FAdError AdError;
+    FAdReward Reward;
+    FSdkConfiguration SdkConfiguration;
+    FCmpError CmpError;
+
+    /** FPlatformTime::Seconds() when the event was queued. */
+    double EnqueueTime = 0.0;
+};
+
+/**
+ * Lock-free multi-producer queue that hands events from the native plugin threads to the game thread, or another task graph thread.
+ * Events queued before that thread gets to them are drained together by a single task, so they are always handled in the order they were queued.
+ */
+class FAppLovinMAXEventQueue
+{
+public:
+    using FHandler = TFunction<void(const FAppLovinMAXQueuedEvent &)>;
+
+    /**
+     * @param InHandler Called on the drain thread for each event, in the order the events were queued.
+     * @param InThread Task graph thread to drain on. With ENamedThreads::AnyThread the drains run on worker threads, one at a time.
+     */
+    explicit FAppLovinMAXEventQueue(FHandler InHandler, ENamedThreads::Type InThread = ENamedThreads::GameThread);
+
+    /** Queues an event and schedules a drain on the queue's thread if one is not already pending. Safe to call from any thread. */
+    void Enqueue(FAppLovinMAXQueuedEvent &&Event);
+
+    /** Returns the number of events waiting to be drained. Safe to call from any thread. */
+    int32 GetDepth() const;
+
+    /** Returns the number of drain tasks posted to the queue's thread that have not finished yet, which is at most one. Safe to call from any thread. */
+    int32 GetPendingTaskCount() const;
+
+    /** Returns the time in seconds that the oldest waiting event has been queued, or 0 if the queue is empty. Must be called on the queue's thread. */
+    double GetOldestEventAge() const;
+
+private:
+    void ScheduleDrain();
+    void Drain();
+
+    FHandler Handler;
+    ENamedThreads::Type Thread;
+    TQueue<FAppLovinMAXQueuedEvent, EQueueMode::Mpsc> Queue;
+    std::atomic<int32> Depth{0};
+    std::atomic<bool> bIsDrainScheduled{false};
+};
@@ -0,0 +1,461 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXEventRecorder.h"
+#include "AppLovinMAXLogger.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+// Defined in AppLovinMAX.cpp
+void ForwardEvent(const FString &Name, const FString &Body);
+void ForwardBinaryEvent(const FString &Name, const uint8 *Data, int32 Length);
+
+namespace
+{
+    constexpr uint8 LogMagic[4] = {'A', 'M', 'E', 'L'};
+    constexpr uint32 LogVersion = 1;
+
+    enum class EBodyType : uint8
+    {
+        Json = 0,
+        Binary = 1
+    };
+
+    // uint64 timestamp, uint8 body type, uint16 name byte count, uint32 body byte count
+    constexpr int32 RecordHeaderSize = 8 + 1 + 2 + 4;
+
+    // The writer also wakes up early once the ring buffer is this full
+    constexpr double WriterWakeUpFill = 0.5;
+    constexpr uint32 WriterIntervalMs = 50;
+
+    FString ResolveLogPath(const FString &FilePath)
+    {
+        return FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AppLovinMAX"), FilePath) : FilePath;
+    }
+
+    /**
+     * Single-consumer ring buffer of encoded records and the background thread that writes it to the log file.
+     * Producers append under a lock and only into free space, so the writer can copy committed bytes out without taking the lock.
+     */
+    class FEventLogWriter final : public FRunnable
+    {
+    public:
+        FEventLogWriter(TUniquePtr<FArchive> &&InFile, int32 BufferSize)
+            : File(MoveTemp(InFile))
+        {
+            Ring.SetNumUninitialized(FMath::Max(BufferSize, 4 * 1024));
+            StartCycles = FPlatformTime::Cycles64();
+            WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+            Thread = FRunnableThread::Create(this, TEXT("AppLovinMAXEventRecorder"), 0, TPri_BelowNormal);
+        }
+
+        virtual ~FEventLogWriter() override
+        {
+            bIsStopping.store(true);
+            WakeEvent->Trigger();
+            if (Thread != nullptr)
+            {
+                Thread->WaitForCompletion();
+                delete Thread;
+            }
+
+            WriteCommitted();
+            File->Close();
+            FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+
+            if (DroppedCount > 0)
+            {
+                MAX_W("Event recording dropped %d events because the ring buffer was full", DroppedCount);
+            }
+        }
+
+        void Append(EBodyType BodyType, const ANSICHAR *Name, int32 NameLength, const uint8 *Body, int32 BodyLength)
+        {
+            NameLength = FMath::Min(NameLength, (int32)MAX_uint16);
+            const uint64 Capacity = Ring.Num();
+            const uint64 RecordSize = RecordHeaderSize + NameLength + BodyLength;
+
+            bool bShouldWakeWriter;
+            {
+                FScopeLock ScopeLock(&AppendLock);
+
+                const uint64 WriteOffset = Head.load(std::memory_order_relaxed);
+                const uint64 FreeSpace = Capacity - (WriteOffset - Tail.load(std::memory_order_acquire));
+                if (RecordSize > FreeSpace)
+                {
+                    DroppedCount++;
+                    return;
+                }
+
+                uint8 Header[RecordHeaderSize];
+                const uint64 Timestamp = INTEL_ORDER64((uint64)((FPlatformTime::Cycles64() - StartCycles) * FPlatformTime::GetSecondsPerCycle64() * 1e9));
+                const uint16 NameSize = INTEL_ORDER16((uint16)NameLength);
+                const uint32 BodySize = INTEL_ORDER32((uint32)BodyLength);
+                FMemory::Memcpy(Header, &Timestamp, 8);
+                Header[8] = (uint8)BodyType;
+                FMemory::Memcpy(Header + 9, &NameSize, 2);
+                FMemory::Memcpy(Header + 11, &BodySize, 4);
+
+                uint64 Offset = WriteOffset;
+                CopyIn(Offset, Header, RecordHeaderSize);
+                CopyIn(Offset, (const uint8 *)Name, NameLength);
+                CopyIn(Offset, Body, BodyLength);
+
+                Head.store(Offset, std::memory_order_release);
+                bShouldWakeWriter = Offset - Tail.load(std::memory_order_relaxed) > Capacity * WriterWakeUpFill;
+            }
+
+            if (bShouldWakeWriter)
+            {
+                WakeEvent->Trigger();
+            }
+        }
+
+        // MARK: FRunnable
+
+        virtual uint32 Run() override
+        {
+            while (!bIsStopping.load())
+            {
+                WakeEvent->Wait(WriterIntervalMs);
+                WriteCommitted();
+            }
+            return 0;
+        }
+
+    private:
+        // Expects AppendLock to be held
+        void CopyIn(uint64 &Offset, const uint8 *Data, int32 Length)
+        {
+            const int32 Start = (int32)(Offset % Ring.Num());
+            const int32 FirstPart = FMath::Min(Length, Ring.Num() - Start);
+            FMemory::Memcpy(Ring.GetData() + Start, Data, FirstPart);
+            FMemory::Memcpy(Ring.GetData(), Data + FirstPart, Length - FirstPart);
+            Offset += Length;
+        }
+
+        // Only called on the writer thread, or after it has finished
+        void WriteCommitted()
+        {
+            const uint64 ReadOffset = Tail.load(std::memory_order_relaxed);
+            const uint64 CommittedOffset = Head.load(std::memory_order_acquire);
+            if (CommittedOffset == ReadOffset) return;
+
+            const int32 Start = (int32)(ReadOffset % Ring.Num());
+            const int32 Length = (int32)(CommittedOffset - ReadOffset);
+            const int32 FirstPart = FMath::Min(Length, Ring.Num() - Start);
+            File->Serialize(Ring.GetData() + Start, FirstPart);
+            File->Serialize(Ring.GetData(), Length - FirstPart);
+            File->Flush();
+
+            Tail.store(CommittedOffset, std::memory_order_release);
+        }
+
+        TUniquePtr<FArchive> File;
+        TArray<uint8> Ring;
+        uint64 StartCycles = 0;
+
+        // Total bytes ever appended and written; their difference is the number of bytes waiting in the ring
+        std::atomic<uint64> Head{0};
+        std::atomic<uint64> Tail{0};
+
+        FCriticalSection AppendLock;
+        int32 DroppedCount = 0;
+
+        FEvent *WakeEvent = nullptr;
+        FRunnableThread *Thread = nullptr;
+        std::atomic<bool> bIsStopping{false};
+    };
+
+    /** Reads records one at a time and forwards them at their recorded times, scaled by the playback speed. */
+    class FEventLogReplayer final : public FRunnable
+    {
+    public:
+        FEventLogReplayer(TUniquePtr<FArchive> &&InFile, float InSpeed)
+            : File(MoveTemp(InFile)), Speed(FMath::Max(InSpeed, 0.0f))
+        {
+            Thread = FRunnableThread::Create(this, TEXT("AppLovinMAXEventReplayer"));
+        }
+
+        virtual ~FEventLogReplayer() override
+        {
+            bIsStopping.store(true);
+            if (Thread != nullptr)
+            {
+                Thread->WaitForCompletion();
+                delete Thread;
+            }
+        }
+
+        bool IsFinished() const { return bIsFinished.load(); }
+
+        // MARK: FRunnable
+
+        virtual uint32 Run() override
+        {
+            const double StartTime = FPlatformTime::Seconds();
+            int32 ReplayedCount = 0;
+
+            TArray<uint8> Name;
+            TArray<uint8> Body;
+            uint8 Header[RecordHeaderSize];
+            while (!bIsStopping.load() && File->Tell() + RecordHeaderSize <= File->TotalSize())
+            {
+                File->Serialize(Header, RecordHeaderSize);
+
+                uint64 Timestamp;
+                uint16 NameSize;
+                uint32 BodySize;
+                FMemory::Memcpy(&Timestamp, Header, 8);
+                FMemory::Memcpy(&NameSize, Header + 9, 2);
+                FMemory::Memcpy(&BodySize, Header + 11, 4);
+                const EBodyType BodyType = (EBodyType)Header[8];
+
+                // Reset keeps the allocations, so the buffers only grow to the largest record
+                Name.Reset();
+                Name.AddUninitialized(INTEL_ORDER16(NameSize));
+                Body.Reset();
+                Body.AddUninitialized(INTEL_ORDER32(BodySize));
+                if (File->Tell() + Name.Num() + Body.Num() > File->TotalSize())
+                {
+                    MAX_W("Event log ends with a truncated record");
+                    break;
+                }
+                File->Serialize(Name.GetData(), Name.Num());
+                File->Serialize(Body.GetData(), Body.Num());
+
+                if (Speed > 0.0f && !WaitUntil(StartTime + INTEL_ORDER64(Timestamp) / 1e9 / Speed)) break;
+
+                const FString EventName(FUTF8ToTCHAR((const ANSICHAR *)Name.GetData(), Name.Num()));
+                if (BodyType == EBodyType::Binary)
+                {
+                    ForwardBinaryEvent(EventName, Body.GetData(), Body.Num());
+                }
+                else
+                {
+                    ForwardEvent(EventName, FString(FUTF8ToTCHAR((const ANSICHAR *)Body.GetData(), Body.Num())));
+                }
+                ReplayedCount++;
+            }
+
+            MAX_D("Replayed %d events in %.3f seconds", ReplayedCount, FPlatformTime::Seconds() - StartTime);
+            bIsFinished.store(true);
+            return 0;
+        }
+
+    private:
+        // Sleeps in short steps so that a stop request is not held up by a long gap between events
+        bool WaitUntil(double Time)
+        {
+            for (double Remaining = Time - FPlatformTime::Seconds(); Remaining > 0.0; Remaining = Time - FPlatformTime::Seconds())
+            {
+                if (bIsStopping.load()) return false;
+                FPlatformProcess::SleepNoStats((float)FMath::Min(Remaining, 0.05));
+            }
+            return true;
+        }
+
+        TUniquePtr<FArchive> File;
+        float Speed;
+
+        FRunnableThread *Thread = nullptr;
+        std::atomic<bool> bIsStopping{false};
+        std::atomic<bool> bIsFinished{false};
+    };
+
+    // Guards Recorder, and serializes appends with starting and stopping
+    FCriticalSection RecorderLock;
+    TUniquePtr<FEventLogWriter> Recorder;
+
+    // Checked before taking the lock so that events are not slowed down when not recording
+    std::atomic<bool> bIsRecording{false};
+
+    FCriticalSection ReplayerLock;
+    TUniquePtr<FEventLogReplayer> Replayer;
+} // namespace
+
+// MARK: - Recording
+
+bool AppLovinMAXEventRecorder::StartRecording(const FString &FilePath, int32 BufferSize)
+{
+    StopRecording();
+
+    const FString ResolvedPath = ResolveLogPath(FilePath);
+    TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*ResolvedPath));
+    if (!File.IsValid())
+    {
+        MAX_E("Failed to create event log: %s", *ResolvedPath);
+        return false;
+    }
+
+    uint8 Header[8];
+    const uint32 Version = INTEL_ORDER32(LogVersion);
+    FMemory::Memcpy(Header, LogMagic, 4);
+    FMemory::Memcpy(Header + 4, &Version, 4);
+    File->Serialize(Header, sizeof(Header));
+
+    {
+        FScopeLock ScopeLock(&RecorderLock);
+        Recorder = MakeUnique<FEventLogWriter>(MoveTemp(File), BufferSize);
+    }
+    bIsRecording.store(true);
+
+    MAX_D("Recording events to %s", *ResolvedPath);
+    return true;
+}
+
+void AppLovinMAXEventRecorder::StopRecording()
+{
+    bIsRecording.store(false);
+
+    TUniquePtr<FEventLogWriter> StoppedRecorder;
+    {
+        FScopeLock ScopeLock(&RecorderLock);
+        StoppedRecorder = MoveTemp(Recorder);
+    }
+
+    // Destroyed outside the lock since it waits for the writer thread to finish the file
+    StoppedRecorder.Reset();
+}
+
+bool AppLovinMAXEventRecorder::IsRecording()
+{
+    return bIsRecording.load(std::memory_order_relaxed);
+}
+
+void AppLovinMAXEventRecorder::RecordEvent(const FString &Name, const FString &Body)
+{
+    if (!bIsRecording.load(std::memory_order_relaxed)) return;
+
+    const FTCHARToUTF8 NameUtf8(*Name, Name.Len());
+    const FTCHARToUTF8 BodyUtf8(*Body, Body.Len());
+
+    FScopeLock ScopeLock(&RecorderLock);
+    if (Recorder.IsValid())
+    {
+        Recorder->Append(EBodyType::Json, NameUtf8.Get(), NameUtf8.Length(), (const uint8 *)BodyUtf8.Get(), BodyUtf8.Length());
+    }
+}
+
+void AppLovinMAXEventRecorder::RecordBinaryEvent(const FString &Name, const uint8 *Data, int32 Length)
+{
+    if (!bIsRecording.load(std::memory_order_relaxed)) return;
+
+    const FTCHARToUTF8 NameUtf8(*Name, Name.Len());
+
+    FScopeLock ScopeLock(&RecorderLock);
+    if (Recorder.IsValid())
+    {
+        Recorder->Append(EBodyType::Binary, NameUtf8.Get(), NameUtf8.Length(), Data, Length);
+    }
+}
+
+// MARK: - Replay
+
+bool AppLovinMAXEventRecorder::StartReplay(const FString &FilePath, float Speed)
+{
+    StopReplay();
+
+    const FString ResolvedPath = ResolveLogPath(FilePath);
+    TUniquePtr<FArchive> File(IFileManager::Get().CreateFileReader(*ResolvedPath));
+    if (!File.IsValid())
+    {
+        MAX_E("Failed to open event log: %s", *ResolvedPath);
+        return false;
+    }
+
+    uint8 Header[8] = {};
+    uint32 Version = 0;
+    if (File->TotalSize() >= (int64)sizeof(Header))
+    {
+        File->Serialize(Header, sizeof(Header));
+        FMemory::Memcpy(&Version, Header + 4, 4);
+    }
+    if (FMemory::Memcmp(Header, LogMagic, 4) != 0 || INTEL_ORDER32(Version) != LogVersion)
+    {
+        MAX_E("Not a supported event log: %s", *ResolvedPath);
+        return false;
+    }
+
+    MAX_D("Replaying events from %s at %.2fx speed", *ResolvedPath, Speed);
+
+    FScopeLock ScopeLock(&ReplayerLock);
+    Replayer = MakeUnique<FEventLogReplayer>(MoveTemp(File), Speed);
+    return true;
+}
+
+void AppLovinMAXEventRecorder::StopReplay()
+{
+    TUniquePtr<FEventLogReplayer> StoppedReplayer;
+    {
+        FScopeLock ScopeLock(&ReplayerLock);
+        StoppedReplayer = MoveTemp(Replayer);
+    }
+    StoppedReplayer.Reset();
+}
+
+bool AppLovinMAXEventRecorder::IsReplaying()
+{
+    FScopeLock ScopeLock(&ReplayerLock);
+    return Replayer.IsValid() && !Replayer->IsFinished();
+}
+
+// MARK: - Console Commands
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+    void RunRecordEvents(const TArray<FString> &Args)
+    {
+        if (Args.Num() < 1)
+        {
+            MAX_W("Usage: AppLovinMAX.RecordEvents <File> [BufferSizeKB=1024]");
+            return;
+        }
+
+        const int32 BufferSizeKB = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 1024;
+        AppLovinMAXEventRecorder::StartRecording(Args[0], FMath::Max(BufferSizeKB, 4) * 1024);
+    }
+
+    void RunReplayEvents(const TArray<FString> &Args)
+    {
+        if (Args.Num() < 1)
+        {
+            MAX_W("Usage: AppLovinMAX.ReplayEvents <File> [Speed=1]");
+            return;
+        }
+
+        const float Speed = Args.IsValidIndex(1) ? FCString::Atof(*Args[1]) : 1.0f;
+        AppLovinMAXEventRecorder::StartReplay(Args[0], Speed);
+    }
+
+    FAutoConsoleCommand RecordEventsCommand(
+        TEXT("AppLovinMAX.RecordEvents"),
+        TEXT("Records the events forwarded by the native plugin to a binary log. Relative paths are resolved against Saved/AppLovinMAX. Usage: AppLovinMAX.RecordEvents <File> [BufferSizeKB=1024]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunRecordEvents));
+
+    FAutoConsoleCommand StopRecordingEventsCommand(
+        TEXT("AppLovinMAX.StopRecordingEvents"),
+        TEXT("Stops recording events and finishes the log."),
+        FConsoleCommandDelegate::CreateStatic(&AppLovinMAXEventRecorder::StopRecording));
+
+    FAutoConsoleCommand ReplayEventsCommand(
+        TEXT("AppLovinMAX.ReplayEvents"),
+        TEXT("Replays a recorded event log through the event pipeline. Speed 1 keeps the recorded timing, 0 replays as fast as possible. Usage: AppLovinMAX.ReplayEvents <File> [Speed=1]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunReplayEvents));
+
+    FAutoConsoleCommand StopReplayCommand(
+        TEXT("AppLovinMAX.StopReplay"),
+        TEXT("Stops the event replay in progress."),
+        FConsoleCommandDelegate::CreateStatic(&AppLovinMAXEventRecorder::StopReplay));
+} // namespace
+
+#endif
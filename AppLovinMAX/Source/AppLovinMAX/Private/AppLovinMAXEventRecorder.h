@@ -0,0 +1,47 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Records the events forwarded by the native plugins to a compact binary log, and replays such logs through the same forwarding path,
+ * so that the event load of a device session can be reproduced on a desktop build with the mock backend.
+ *
+ * Log format, all numbers little-endian: the magic "AMEL" and a uint32 version, followed by one record per event holding
+ * the uint64 nanoseconds since recording started, a uint8 body type (0 = JSON, 1 = binary ad event), the uint16 name byte count,
+ * the uint32 body byte count, the UTF-8 name and the body bytes.
+ */
+namespace AppLovinMAXEventRecorder
+{
+    /**
+     * Starts recording forwarded events to a new log file. Events are copied into a pre-allocated ring buffer that a background thread writes out,
+     * and are dropped rather than blocking the native plugin thread if the buffer fills up.
+     * @param FilePath - Path of the log file. Relative paths are resolved against Saved/AppLovinMAX.
+     * @param BufferSize - Size of the ring buffer in bytes
+     * @return False if the file could not be created
+     */
+    bool StartRecording(const FString &FilePath, int32 BufferSize = 1024 * 1024);
+
+    /** Stops recording and writes out the remaining buffered events. */
+    void StopRecording();
+
+    bool IsRecording();
+
+    /** Appends an event to the log if recording. Called from ForwardEvent and ForwardBinaryEvent on the native plugin threads. */
+    void RecordEvent(const FString &Name, const FString &Body);
+    void RecordBinaryEvent(const FString &Name, const uint8 *Data, int32 Length);
+
+    /**
+     * Streams a log back through ForwardEvent and ForwardBinaryEvent on a background thread, like events from the native plugins.
+     * Replaces any replay in progress.
+     * @param FilePath - Path of the log file. Relative paths are resolved against Saved/AppLovinMAX.
+     * @param Speed - Playback speed relative to the recording, e.g. 2 replays twice as fast. 0 replays as fast as possible.
+     * @return False if the file could not be opened or is not an event log
+     */
+    bool StartReplay(const FString &FilePath, float Speed = 1.0f);
+
+    void StopReplay();
+
+    bool IsReplaying();
+} // namespace AppLovinMAXEventRecorder
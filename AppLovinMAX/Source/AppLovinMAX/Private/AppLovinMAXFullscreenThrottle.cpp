@@ -0,0 +1,232 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXFullscreenThrottle.h"
+#include "AppLovinMAXLogger.h"
+#include "Async/Async.h"
+#include "AudioDevice.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "RenderTargetPool.h"
+#include "RenderingThread.h"
+#include <atomic>
+
+namespace
+{
+    // What was changed for the current ad, so that only those changes are undone. Only touched on the game thread.
+    struct FThrottleState
+    {
+        FAppLovinMAXThrottleSettings Settings;
+        bool bIsThrottling = false;
+        bool bChangedMaxFPS = false;
+        float SavedMaxFPS = 0.0f;
+        bool bDisabledWorldRendering = false;
+        bool bSuspendedAudio = false;
+        TWeakObjectPtr<UWorld> PausedWorld;
+        int32 PrewarmFramesLeft = 0;
+        FTSTicker::FDelegateHandle PrewarmTickerHandle;
+    };
+
+    FThrottleState ThrottleState;
+
+    // Read by the native plugin threads for every event
+    std::atomic<bool> bIsThrottlingEnabled{false};
+
+    bool IsFullscreenAdDisplayedEvent(EAppLovinMAXEvent Event)
+    {
+        return Event == EAppLovinMAXEvent::InterstitialAdDisplayed || Event == EAppLovinMAXEvent::RewardedAdDisplayed;
+    }
+
+    bool IsFullscreenAdDismissedEvent(EAppLovinMAXEvent Event)
+    {
+        return Event == EAppLovinMAXEvent::InterstitialAdHidden || Event == EAppLovinMAXEvent::InterstitialAdDisplayFailed ||
+               Event == EAppLovinMAXEvent::RewardedAdHidden || Event == EAppLovinMAXEvent::RewardedAdDisplayFailed;
+    }
+
+    UWorld *GetGameWorld()
+    {
+        return GEngine && GEngine->GameViewport ? GEngine->GameViewport->GetWorld() : nullptr;
+    }
+
+    void UnpauseWorld()
+    {
+        UWorld *World = ThrottleState.PausedWorld.Get();
+        ThrottleState.PausedWorld.Reset();
+        if (World && World->IsPaused())
+        {
+            UGameplayStatics::SetGamePaused(World, false);
+        }
+    }
+
+    void StopPrewarm()
+    {
+        if (ThrottleState.PrewarmTickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(ThrottleState.PrewarmTickerHandle);
+            ThrottleState.PrewarmTickerHandle.Reset();
+        }
+    }
+
+    bool TickPrewarm(float DeltaTime)
+    {
+        if (--ThrottleState.PrewarmFramesLeft > 0) return true;
+
+        UnpauseWorld();
+        ThrottleState.PrewarmTickerHandle.Reset();
+        return false;
+    }
+
+    void Throttle()
+    {
+        if (ThrottleState.bIsThrottling || !GEngine) return;
+
+        const FAppLovinMAXThrottleSettings &Settings = ThrottleState.Settings;
+        ThrottleState.bIsThrottling = true;
+
+        // Back to back ads: the world may still be paused from the previous ad, in which case it simply stays paused
+        StopPrewarm();
+
+        if (Settings.bPauseWorld && !ThrottleState.PausedWorld.IsValid())
+        {
+            UWorld *World = GetGameWorld();
+            if (World && !World->IsPaused() && UGameplayStatics::SetGamePaused(World, true))
+            {
+                ThrottleState.PausedWorld = World;
+            }
+        }
+
+        if (Settings.ThrottledMaxFPS > 0.0f)
+        {
+            ThrottleState.SavedMaxFPS = GEngine->GetMaxFPS();
+            ThrottleState.bChangedMaxFPS = true;
+            GEngine->SetMaxFPS(Settings.ThrottledMaxFPS);
+        }
+
+        if (Settings.bSuspendRendering && GEngine->GameViewport && !GEngine->GameViewport->bDisableWorldRendering)
+        {
+            GEngine->GameViewport->bDisableWorldRendering = true;
+            ThrottleState.bDisabledWorldRendering = true;
+        }
+
+        if (Settings.bSuspendAudio)
+        {
+            if (FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice())
+            {
+                AudioDevice->SuspendContext();
+                ThrottleState.bSuspendedAudio = true;
+            }
+        }
+
+        if (Settings.bReleaseRenderTargets)
+        {
+            ENQUEUE_RENDER_COMMAND(AppLovinMAXReleaseRenderTargets)([](FRHICommandListImmediate &RHICmdList)
+            {
+                GRenderTargetPool.FreeUnusedResources();
+            });
+        }
+
+        MAX_USER_DEBUG("Throttling engine while fullscreen ad is displayed");
+    }
+
+    void Restore(bool bPrewarm)
+    {
+        if (!ThrottleState.bIsThrottling) return;
+
+        ThrottleState.bIsThrottling = false;
+
+        if (GEngine)
+        {
+            if (ThrottleState.bChangedMaxFPS)
+            {
+                GEngine->SetMaxFPS(ThrottleState.SavedMaxFPS);
+            }
+
+            if (ThrottleState.bDisabledWorldRendering && GEngine->GameViewport)
+            {
+                GEngine->GameViewport->bDisableWorldRendering = false;
+            }
+
+            if (ThrottleState.bSuspendedAudio)
+            {
+                if (FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice())
+                {
+                    AudioDevice->ResumeContext();
+                }
+            }
+        }
+
+        ThrottleState.bChangedMaxFPS = false;
+        ThrottleState.bDisabledWorldRendering = false;
+        ThrottleState.bSuspendedAudio = false;
+
+        // Render a few frames with rendering and audio back but gameplay still paused, so that the first gameplay frame does not pay for the warm-up
+        const int32 PrewarmFrames = ThrottleState.Settings.PrewarmFrames;
+        if (bPrewarm && PrewarmFrames > 0 && ThrottleState.PausedWorld.IsValid())
+        {
+            ThrottleState.PrewarmFramesLeft = PrewarmFrames;
+            ThrottleState.PrewarmTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickPrewarm));
+        }
+        else
+        {
+            UnpauseWorld();
+        }
+
+        MAX_USER_DEBUG("Restored engine after fullscreen ad");
+    }
+} // namespace
+
+void AppLovinMAXFullscreenThrottle::SetEnabled(bool bEnabled, const FAppLovinMAXThrottleSettings &Settings)
+{
+    check(IsInGameThread());
+
+    if (!bEnabled)
+    {
+        Restore(true);
+    }
+
+    // Settings take effect from the next ad, so that a displayed ad is restored with the settings it was throttled with
+    if (!ThrottleState.bIsThrottling)
+    {
+        ThrottleState.Settings = Settings;
+    }
+
+    bIsThrottlingEnabled.store(bEnabled);
+}
+
+bool AppLovinMAXFullscreenThrottle::IsThrottling()
+{
+    check(IsInGameThread());
+    return ThrottleState.bIsThrottling;
+}
+
+void AppLovinMAXFullscreenThrottle::HandleAdEvent(EAppLovinMAXEvent Event)
+{
+    if (!bIsThrottlingEnabled.load(std::memory_order_relaxed)) return;
+
+    if (IsFullscreenAdDisplayedEvent(Event))
+    {
+        AsyncTask(ENamedThreads::GameThread, []()
+        {
+            // Throttling may have been disabled while the task was queued
+            if (bIsThrottlingEnabled.load(std::memory_order_relaxed))
+            {
+                Throttle();
+            }
+        });
+    }
+    else if (IsFullscreenAdDismissedEvent(Event))
+    {
+        AsyncTask(ENamedThreads::GameThread, []()
+        {
+            Restore(true);
+        });
+    }
+}
+
+void AppLovinMAXFullscreenThrottle::Shutdown()
+{
+    bIsThrottlingEnabled.store(false);
+    StopPrewarm();
+}
@@ -0,0 +1,26 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AppLovinMAXEvent.h"
+#include "AppLovinMAXThrottleSettings.h"
+
+/**
+ * Opt-in throttling of the engine while an interstitial or rewarded ad is displayed, driven by the display, hide and display failure events.
+ * Throttling and restoring happen on the game thread; the events themselves may arrive on any thread.
+ */
+namespace AppLovinMAXFullscreenThrottle
+{
+    /** Enables or disables throttling. Disabling while an ad is displayed restores the engine right away. Must be called on the game thread. */
+    void SetEnabled(bool bEnabled, const FAppLovinMAXThrottleSettings &Settings);
+
+    /** Returns true while the engine is throttled for a displayed ad. Must be called on the game thread. */
+    bool IsThrottling();
+
+    /** Throttles or restores the engine if throttling is enabled and the event is a fullscreen ad display, hide or display failure. Safe to call from any thread. */
+    void HandleAdEvent(EAppLovinMAXEvent Event);
+
+    /** Stops any pending restore. Called when the module shuts down. */
+    void Shutdown();
+} // namespace AppLovinMAXFullscreenThrottle
@@ -0,0 +1,54 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Fixed size table that interns strings to the index of their slot, so that per-key state can live in plain arrays indexed by it.
+ * Open addressing with linear probing. Slots are claimed with a compare-exchange so concurrent callers agree on a single index per key,
+ * and keys are never changed or freed afterwards, so lookups are lock-free.
+ */
+template <int32 Capacity>
+class TAppLovinMAXInternTable
+{
+public:
+    /** Returns the index of the key, adding it the first time, or INDEX_NONE if all slots are taken by other keys. */
+    int32 FindOrAdd(const FString &Key)
+    {
+        const uint32 StartIndex = GetTypeHash(Key) % Capacity;
+        for (int32 Probe = 0; Probe < Capacity; Probe++)
+        {
+            const int32 Index = (StartIndex + Probe) % Capacity;
+            const FString *SlotKey = Keys[Index].load(std::memory_order_acquire);
+            if (SlotKey == nullptr)
+            {
+                const FString *NewKey = new FString(Key);
+                if (Keys[Index].compare_exchange_strong(SlotKey, NewKey, std::memory_order_acq_rel))
+                {
+                    return Index;
+                }
+
+                // Another thread claimed the slot first; SlotKey now holds its key
+                delete NewKey;
+            }
+
+            if (SlotKey->Equals(Key, ESearchCase::CaseSensitive))
+            {
+                return Index;
+            }
+        }
+
+        return INDEX_NONE;
+    }
+
+    /** Returns the key interned at the index, or nullptr if the index is out of range or unused. */
+    const FString *Get(int32 Index) const
+    {
+        return Index >= 0 && Index < Capacity ? Keys[Index].load(std::memory_order_acquire) : nullptr;
+    }
+
+private:
+    std::atomic<const FString *> Keys[Capacity] = {};
+};
@@ -3,15 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AppLovinMAX.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAppLovinMAX, Log, All);
 
-DEFINE_LOG_CATEGORY(LogAppLovinMAX);
-
 #define MAX_D(message, ...)           UE_LOG(LogAppLovinMAX, Display, TEXT(message), ##__VA_ARGS__)
 #define MAX_W(message, ...)           UE_LOG(LogAppLovinMAX, Warning, TEXT(message), ##__VA_ARGS__)
 #define MAX_E(message, ...)           UE_LOG(LogAppLovinMAX, Error, TEXT(message), ##__VA_ARGS__)
 
+// NOTE: IsVerboseLoggingEnabled() reads a cached copy of the setting, so these are cheap when verbose logging is off
 #define MAX_USER_DEBUG(message, ...)      { if (UAppLovinMAX::IsVerboseLoggingEnabled()) { UE_LOG(LogAppLovinMAX, Display, TEXT(message), ##__VA_ARGS__) }}
 #define MAX_USER_WARN(message, ...)    { if (UAppLovinMAX::IsVerboseLoggingEnabled()) { UE_LOG(LogAppLovinMAX, Warning, TEXT(message), ##__VA_ARGS__) }}
 #define MAX_USER_ERROR(message, ...)      { if (UAppLovinMAX::IsVerboseLoggingEnabled()) { UE_LOG(LogAppLovinMAX, Error, TEXT(message), ##__VA_ARGS__) }}
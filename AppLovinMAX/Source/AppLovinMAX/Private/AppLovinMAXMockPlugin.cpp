@@ -0,0 +1,359 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXMockPlugin.h"
+
+#if !PLATFORM_IOS && !PLATFORM_ANDROID
+
+#include "AppLovinMAX.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    // Error codes and messages match the ones reported by the native SDKs
+    constexpr int32 NoFillErrorCode = 204;
+    constexpr int32 FullscreenAdNotReadyErrorCode = -24;
+
+    using FCondensedJsonWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+    using FCondensedJsonWriterFactory = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+    // Orders the scheduled events as a min-heap by due time, then by scheduling order
+    struct FScheduledEventOrder
+    {
+        template <typename EventType>
+        bool operator()(const EventType &A, const EventType &B) const
+        {
+            return A.Time < B.Time || (A.Time == B.Time && A.Sequence < B.Sequence);
+        }
+    };
+} // namespace
+
+FAppLovinMAXMockPlugin::FAppLovinMAXMockPlugin(FEventCallback InEventCallback)
+    : EventCallback(InEventCallback)
+{
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAppLovinMAXMockPlugin::Tick));
+}
+
+FAppLovinMAXMockPlugin::~FAppLovinMAXMockPlugin()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+void FAppLovinMAXMockPlugin::SetSettings(const FAppLovinMAXMockSettings &InSettings)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    Settings = InSettings;
+    RandomStream.Initialize(Settings.Seed);
+    ScheduledEvents.Reset();
+    LoadedFullscreenAds.Reset();
+    AdViewGenerations.Reset();
+}
+
+// MARK: - Initialization
+
+void FAppLovinMAXMockPlugin::Initialize()
+{
+    FScopeLock ScopeLock(&Lock);
+    if (!Settings.bEnabled) return;
+
+    Schedule(RollLoadLatency(), TEXT("OnSdkInitializedEvent"), GetSdkConfigurationBody(), [this]()
+    {
+        bIsInitialized = true;
+        return true;
+    });
+}
+
+bool FAppLovinMAXMockPlugin::IsInitialized()
+{
+    FScopeLock ScopeLock(&Lock);
+    return bIsInitialized;
+}
+
+// MARK: - Ad Units
+
+void FAppLovinMAXMockPlugin::SetAdUnitHandle(const FString &AdUnitIdentifier, int32 Handle)
+{
+    FScopeLock ScopeLock(&Lock);
+    AdUnitHandles.Add(AdUnitIdentifier, Handle);
+}
+
+// MARK: - Banners
+
+void FAppLovinMAXMockPlugin::CreateBanner(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    CreateAdView(AdUnitIdentifier, false);
+}
+
+void FAppLovinMAXMockPlugin::DestroyBanner(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    AdViewGenerations.Remove(AdUnitIdentifier);
+}
+
+// MARK: - MRECs
+
+void FAppLovinMAXMockPlugin::CreateMRec(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    CreateAdView(AdUnitIdentifier, true);
+}
+
+void FAppLovinMAXMockPlugin::DestroyMRec(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    AdViewGenerations.Remove(AdUnitIdentifier);
+}
+
+// MARK: - Interstitials
+
+void FAppLovinMAXMockPlugin::LoadInterstitial(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    LoadFullscreenAd(AdUnitIdentifier, false);
+}
+
+bool FAppLovinMAXMockPlugin::IsInterstitialReady(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    return LoadedFullscreenAds.Contains(AdUnitIdentifier);
+}
+
+void FAppLovinMAXMockPlugin::ShowInterstitial(const FString &AdUnitIdentifier, const FString &Placement)
+{
+    FScopeLock ScopeLock(&Lock);
+    ShowFullscreenAd(AdUnitIdentifier, Placement, false);
+}
+
+void FAppLovinMAXMockPlugin::DestroyInterstitial(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    LoadedFullscreenAds.Remove(AdUnitIdentifier);
+}
+
+// MARK: - Rewarded
+
+void FAppLovinMAXMockPlugin::LoadRewardedAd(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    LoadFullscreenAd(AdUnitIdentifier, true);
+}
+
+bool FAppLovinMAXMockPlugin::IsRewardedAdReady(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    return LoadedFullscreenAds.Contains(AdUnitIdentifier);
+}
+
+void FAppLovinMAXMockPlugin::ShowRewardedAd(const FString &AdUnitIdentifier, const FString &Placement)
+{
+    FScopeLock ScopeLock(&Lock);
+    ShowFullscreenAd(AdUnitIdentifier, Placement, true);
+}
+
+void FAppLovinMAXMockPlugin::DestroyRewardedAd(const FString &AdUnitIdentifier)
+{
+    FScopeLock ScopeLock(&Lock);
+    LoadedFullscreenAds.Remove(AdUnitIdentifier);
+}
+
+// MARK: - Scheduling
+
+void FAppLovinMAXMockPlugin::Schedule(double Delay, const TCHAR *Name, FString &&Body, TFunction<bool()> &&Apply)
+{
+    FScheduledEvent Event;
+    Event.Time = CurrentTime + Delay;
+    Event.Sequence = NextSequence++;
+    Event.Name = Name;
+    Event.Body = MoveTemp(Body);
+    Event.Apply = MoveTemp(Apply);
+    ScheduledEvents.HeapPush(MoveTemp(Event), FScheduledEventOrder());
+}
+
+bool FAppLovinMAXMockPlugin::Tick(float DeltaTime)
+{
+    TArray<FScheduledEvent> DueEvents;
+    {
+        FScopeLock ScopeLock(&Lock);
+        CurrentTime += DeltaTime;
+
+        while (ScheduledEvents.Num() > 0 && ScheduledEvents.HeapTop().Time <= CurrentTime)
+        {
+            FScheduledEvent Event;
+            ScheduledEvents.HeapPop(Event, FScheduledEventOrder());
+            if (!Event.Apply || Event.Apply())
+            {
+                DueEvents.Add(MoveTemp(Event));
+            }
+        }
+    }
+
+    // Send outside the lock since handlers commonly call back into the plugin, e.g. to reload after a load failure
+    for (const FScheduledEvent &Event : DueEvents)
+    {
+        EventCallback(Event.Name, Event.Body);
+    }
+
+    return true;
+}
+
+double FAppLovinMAXMockPlugin::RollLoadLatency()
+{
+    return Settings.LoadLatency + RandomStream.FRandRange(0.0f, Settings.LoadLatencyJitter);
+}
+
+double FAppLovinMAXMockPlugin::RollRevenue()
+{
+    return Settings.RevenuePerImpression * RandomStream.FRandRange(0.5f, 1.5f);
+}
+
+bool FAppLovinMAXMockPlugin::RollFill()
+{
+    return RandomStream.FRand() < Settings.FillRate;
+}
+
+// MARK: - Ad Views
+
+void FAppLovinMAXMockPlugin::CreateAdView(const FString &AdUnitIdentifier, bool bIsMRec)
+{
+    if (!Settings.bEnabled) return;
+
+    const uint32 Generation = NextAdViewGeneration++;
+    AdViewGenerations.Add(AdUnitIdentifier, Generation);
+    LoadAdView(AdUnitIdentifier, bIsMRec, Generation, RollLoadLatency());
+}
+
+void FAppLovinMAXMockPlugin::LoadAdView(const FString &AdUnitIdentifier, bool bIsMRec, uint32 Generation, double Delay)
+{
+    // Loads and refreshes continue until the ad view is destroyed or recreated
+    auto ApplyLoadResult = [this, AdUnitIdentifier, bIsMRec, Generation]()
+    {
+        const uint32 *CurrentGeneration = AdViewGenerations.Find(AdUnitIdentifier);
+        if (CurrentGeneration == nullptr || *CurrentGeneration != Generation) return false;
+
+        if (Settings.AdViewRefreshInterval > 0.0f)
+        {
+            LoadAdView(AdUnitIdentifier, bIsMRec, Generation, Settings.AdViewRefreshInterval);
+        }
+        return true;
+    };
+
+    if (!RollFill())
+    {
+        const int32 ErrorCode = NoFillErrorCode;
+        Schedule(Delay, bIsMRec ? TEXT("OnMRecAdLoadFailedEvent") : TEXT("OnBannerAdLoadFailedEvent"), GetAdEventBody(AdUnitIdentifier, FString(), 0.0, &ErrorCode, TEXT("No Fill")), MoveTemp(ApplyLoadResult));
+        return;
+    }
+
+    // Ad views are shown as soon as they load, so every load is also an impression
+    const double Revenue = RollRevenue();
+    Schedule(Delay, bIsMRec ? TEXT("OnMRecAdLoadedEvent") : TEXT("OnBannerAdLoadedEvent"), GetAdEventBody(AdUnitIdentifier, FString(), Revenue), MoveTemp(ApplyLoadResult));
+    Schedule(Delay, bIsMRec ? TEXT("OnMRecAdRevenuePaidEvent") : TEXT("OnBannerAdRevenuePaidEvent"), GetAdEventBody(AdUnitIdentifier, FString(), Revenue), [this, AdUnitIdentifier, Generation]()
+    {
+        const uint32 *CurrentGeneration = AdViewGenerations.Find(AdUnitIdentifier);
+        return CurrentGeneration != nullptr && *CurrentGeneration == Generation;
+    });
+}
+
+// MARK: - Fullscreen Ads
+
+void FAppLovinMAXMockPlugin::LoadFullscreenAd(const FString &AdUnitIdentifier, bool bIsRewarded)
+{
+    if (!Settings.bEnabled) return;
+
+    const double Delay = RollLoadLatency();
+    if (!RollFill())
+    {
+        const int32 ErrorCode = NoFillErrorCode;
+        Schedule(Delay, bIsRewarded ? TEXT("OnRewardedAdLoadFailedEvent") : TEXT("OnInterstitialAdLoadFailedEvent"), GetAdEventBody(AdUnitIdentifier, FString(), 0.0, &ErrorCode, TEXT("No Fill")));
+        return;
+    }
+
+    const double Revenue = RollRevenue();
+    Schedule(Delay, bIsRewarded ? TEXT("OnRewardedAdLoadedEvent") : TEXT("OnInterstitialAdLoadedEvent"), GetAdEventBody(AdUnitIdentifier, FString(), Revenue), [this, AdUnitIdentifier, Revenue]()
+    {
+        LoadedFullscreenAds.Add(AdUnitIdentifier, Revenue);
+        return true;
+    });
+}
+
+void FAppLovinMAXMockPlugin::ShowFullscreenAd(const FString &AdUnitIdentifier, const FString &Placement, bool bIsRewarded)
+{
+    if (!Settings.bEnabled) return;
+
+    double Revenue = 0.0;
+    if (!LoadedFullscreenAds.RemoveAndCopyValue(AdUnitIdentifier, Revenue))
+    {
+        const int32 ErrorCode = FullscreenAdNotReadyErrorCode;
+        Schedule(0.0, bIsRewarded ? TEXT("OnRewardedAdDisplayFailedEvent") : TEXT("OnInterstitialAdDisplayFailedEvent"), GetAdEventBody(AdUnitIdentifier, Placement, 0.0, &ErrorCode, TEXT("Ad not ready")));
+        return;
+    }
+
+    Schedule(0.0, bIsRewarded ? TEXT("OnRewardedAdDisplayedEvent") : TEXT("OnInterstitialAdDisplayedEvent"), GetAdEventBody(AdUnitIdentifier, Placement, Revenue));
+    Schedule(0.0, bIsRewarded ? TEXT("OnRewardedAdRevenuePaidEvent") : TEXT("OnInterstitialAdRevenuePaidEvent"), GetAdEventBody(AdUnitIdentifier, Placement, Revenue));
+
+    if (bIsRewarded)
+    {
+        Schedule(Settings.DisplayDuration, TEXT("OnRewardedAdReceivedRewardEvent"), GetAdEventBody(AdUnitIdentifier, Placement, Revenue, nullptr, nullptr, true));
+    }
+
+    Schedule(Settings.DisplayDuration, bIsRewarded ? TEXT("OnRewardedAdHiddenEvent") : TEXT("OnInterstitialAdHiddenEvent"), GetAdEventBody(AdUnitIdentifier, Placement, Revenue));
+}
+
+// MARK: - Event Bodies
+
+FString FAppLovinMAXMockPlugin::GetAdEventBody(const FString &AdUnitIdentifier, const FString &Placement, double Revenue, const int32 *ErrorCode, const TCHAR *ErrorMessage, bool bWithReward) const
+{
+    FString Body;
+    TSharedRef<FCondensedJsonWriter> Writer = FCondensedJsonWriterFactory::Create(&Body);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("adUnitIdentifier"), AdUnitIdentifier);
+    if (const int32 *Handle = AdUnitHandles.Find(AdUnitIdentifier))
+    {
+        Writer->WriteValue(TEXT("adUnitHandle"), *Handle);
+    }
+    Writer->WriteValue(TEXT("networkName"), Settings.NetworkName);
+    Writer->WriteValue(TEXT("creativeIdentifier"), FString::Printf(TEXT("mock-%llu"), NextSequence));
+    Writer->WriteValue(TEXT("placement"), Placement);
+    Writer->WriteValue(TEXT("revenue"), Revenue);
+
+    if (ErrorCode != nullptr)
+    {
+        Writer->WriteValue(TEXT("code"), *ErrorCode);
+        Writer->WriteValue(TEXT("message"), FString(ErrorMessage));
+        // A single failed network response in the compact encoding of the native plugins, see ParseWaterfall in AdError.cpp.
+        // The literal is split after each separator that is followed by a digit, since hex escapes would take the digit.
+        Writer->WriteValue(TEXT("waterfallData"), FString::Printf(TEXT("1\x1FMock\x1F\x1F" "0\x1E" "2\x1F" "0\x1F" "0\x1F%d\x1F%s\x1F%s"), *ErrorCode, *Settings.NetworkName, ErrorMessage));
+    }
+
+    if (bWithReward)
+    {
+        Writer->WriteValue(TEXT("label"), Settings.RewardLabel);
+        Writer->WriteValue(TEXT("amount"), Settings.RewardAmount);
+    }
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+    return Body;
+}
+
+FString FAppLovinMAXMockPlugin::GetSdkConfigurationBody() const
+{
+    FString Body;
+    TSharedRef<FCondensedJsonWriter> Writer = FCondensedJsonWriterFactory::Create(&Body);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("consentFlowUserGeography"), (int32)EConsentFlowUserGeography::Other);
+    Writer->WriteValue(TEXT("countryCode"), Settings.CountryCode);
+
+    // Report the values set through UAppLovinMAX so that the SDK configuration does not overwrite them
+    Writer->WriteValue(TEXT("hasUserConsent"), UAppLovinMAX::HasUserConsent());
+    Writer->WriteValue(TEXT("isDoNotSell"), UAppLovinMAX::IsDoNotSell());
+    Writer->WriteValue(TEXT("isTablet"), false);
+    Writer->WriteObjectEnd();
+    Writer->Close();
+    return Body;
+}
+
+#endif
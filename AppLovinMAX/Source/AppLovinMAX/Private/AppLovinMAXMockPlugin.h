@@ -0,0 +1,107 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !PLATFORM_IOS && !PLATFORM_ANDROID
+#include "AppLovinMAXMockSettings.h"
+#include "Containers/Ticker.h"
+#include "Math/RandomStream.h"
+
+/**
+ * Simulated stand-in for the native iOS and Android plugins on platforms without the AppLovin SDK.
+ * Results are scheduled on the core ticker and delivered through the event callback as the same event names and JSON bodies the native plugins send.
+ */
+class FAppLovinMAXMockPlugin
+{
+public:
+    using FEventCallback = void (*)(const FString &Name, const FString &Body);
+
+    explicit FAppLovinMAXMockPlugin(FEventCallback InEventCallback);
+    ~FAppLovinMAXMockPlugin();
+
+    /** Applies new settings, reseeds the random stream and drops any pending events. */
+    void SetSettings(const FAppLovinMAXMockSettings &InSettings);
+
+    // MARK: Initialization
+    void Initialize();
+    bool IsInitialized();
+
+    // MARK: Ad Units
+    void SetAdUnitHandle(const FString &AdUnitIdentifier, int32 Handle);
+
+    // MARK: Banners
+    void CreateBanner(const FString &AdUnitIdentifier);
+    void DestroyBanner(const FString &AdUnitIdentifier);
+
+    // MARK: MRECs
+    void CreateMRec(const FString &AdUnitIdentifier);
+    void DestroyMRec(const FString &AdUnitIdentifier);
+
+    // MARK: Interstitials
+    void LoadInterstitial(const FString &AdUnitIdentifier);
+    bool IsInterstitialReady(const FString &AdUnitIdentifier);
+    void ShowInterstitial(const FString &AdUnitIdentifier, const FString &Placement);
+    void DestroyInterstitial(const FString &AdUnitIdentifier);
+
+    // MARK: Rewarded
+    void LoadRewardedAd(const FString &AdUnitIdentifier);
+    bool IsRewardedAdReady(const FString &AdUnitIdentifier);
+    void ShowRewardedAd(const FString &AdUnitIdentifier, const FString &Placement);
+    void DestroyRewardedAd(const FString &AdUnitIdentifier);
+
+private:
+    struct FScheduledEvent
+    {
+        double Time = 0.0;
+        uint64 Sequence = 0;
+        const TCHAR *Name = nullptr;
+        FString Body;
+
+        /** Applies the event's state change when it is due. Returns false to drop the event instead of sending it. */
+        TFunction<bool()> Apply;
+    };
+
+    bool Tick(float DeltaTime);
+
+    // The private methods below expect Lock to be held
+    void Schedule(double Delay, const TCHAR *Name, FString &&Body, TFunction<bool()> &&Apply = nullptr);
+
+    double RollLoadLatency();
+    double RollRevenue();
+    bool RollFill();
+
+    void CreateAdView(const FString &AdUnitIdentifier, bool bIsMRec);
+    void LoadAdView(const FString &AdUnitIdentifier, bool bIsMRec, uint32 Generation, double Delay);
+    void LoadFullscreenAd(const FString &AdUnitIdentifier, bool bIsRewarded);
+    void ShowFullscreenAd(const FString &AdUnitIdentifier, const FString &Placement, bool bIsRewarded);
+
+    /** Writes an ad event body with the same keys the native plugins send. The error and reward are only written when given. */
+    FString GetAdEventBody(const FString &AdUnitIdentifier, const FString &Placement, double Revenue, const int32 *ErrorCode = nullptr, const TCHAR *ErrorMessage = nullptr, bool bWithReward = false) const;
+    FString GetSdkConfigurationBody() const;
+
+    FEventCallback EventCallback;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    FCriticalSection Lock;
+    FAppLovinMAXMockSettings Settings;
+    FRandomStream RandomStream;
+    double CurrentTime = 0.0;
+    uint64 NextSequence = 0;
+    TArray<FScheduledEvent> ScheduledEvents;
+
+    bool bIsInitialized = false;
+
+    // Sent with each ad event like the native plugins do. Kept across SetSettings since each handle is only set once
+    TMap<FString, int32> AdUnitHandles;
+
+    // Revenue of the loaded ad for each interstitial and rewarded ad unit that is ready to be shown
+    TMap<FString, double> LoadedFullscreenAds;
+
+    // Incremented each time an ad view is created so that refreshes scheduled for a destroyed ad view are dropped
+    TMap<FString, uint32> AdViewGenerations;
+    uint32 NextAdViewGeneration = 1;
+};
+
+#endif
@@ -1,18 +1,31 @@
 // Copyright AppLovin Corporation. All Rights Reserved.
 
 #include "AppLovinMAXModule.h"
+#include "AppLovinMAXAdInventory.h"
+#include "AppLovinMAXEventRecorder.h"
+#include "AppLovinMAXFullscreenThrottle.h"
+#include "AppLovinMAXLogger.h"
+#include "AppLovinMAXStats.h"
 
 #define LOCTEXT_NAMESPACE "FAppLovinMAXModule"
 
+DEFINE_LOG_CATEGORY(LogAppLovinMAX);
+
 void FAppLovinMAXModule::StartupModule()
 {
     // This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+    AppLovinMAXStats::Startup();
 }
 
 void FAppLovinMAXModule::ShutdownModule()
 {
     // This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
     // we call this function before unloading the module.
+    AppLovinMAXStats::Shutdown();
+    AppLovinMAXFullscreenThrottle::Shutdown();
+    AppLovinMAXAdInventory::Shutdown();
+    AppLovinMAXEventRecorder::StopReplay();
+    AppLovinMAXEventRecorder::StopRecording();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,177 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXRevenue.h"
+#include "AppLovinMAXAdUnits.h"
+#include "AppLovinMAXInternTable.h"
+#include "AppLovinMAXLogger.h"
+
+namespace
+{
+    constexpr int32 MaxTrackedKeys = 128;
+
+    // Totals are kept in nano USD so that they can be updated with a single atomic add and do not drift
+    constexpr double NanosPerDollar = 1e9;
+
+    // Weight of the newest impression in the rolling eCPM, which makes it roughly an average of the last 20 impressions
+    constexpr double RollingEcpmWeight = 0.05;
+
+    struct FRevenueTotals
+    {
+        std::atomic<int64> ImpressionCount{0};
+        std::atomic<int64> RevenueNanos{0};
+
+        // Exponentially weighted average revenue per impression in USD
+        std::atomic<double> RollingRevenue{0.0};
+
+        void Add(double Revenue)
+        {
+            const int64 PreviousCount = ImpressionCount.fetch_add(1, std::memory_order_relaxed);
+            RevenueNanos.fetch_add(static_cast<int64>(FMath::RoundToDouble(Revenue * NanosPerDollar)), std::memory_order_relaxed);
+
+            double CurrentRollingRevenue = RollingRevenue.load(std::memory_order_relaxed);
+            double NewRollingRevenue;
+            do
+            {
+                NewRollingRevenue = PreviousCount == 0 ? Revenue : CurrentRollingRevenue + RollingEcpmWeight * (Revenue - CurrentRollingRevenue);
+            } while (!RollingRevenue.compare_exchange_weak(CurrentRollingRevenue, NewRollingRevenue, std::memory_order_relaxed));
+        }
+
+        /** Adds a summary for the key unless no impression was recorded. */
+        void AddSummary(const FString *Key, TArray<FAdRevenueSummary> &OutSummaries) const
+        {
+            const int64 Count = ImpressionCount.load(std::memory_order_relaxed);
+            if (Key == nullptr || Count == 0) return;
+
+            FAdRevenueSummary &Summary = OutSummaries.AddDefaulted_GetRef();
+            Summary.Key = *Key;
+            Summary.ImpressionCount = Count;
+            Summary.Revenue = RevenueNanos.load(std::memory_order_relaxed) / NanosPerDollar;
+            Summary.RollingEcpm = RollingRevenue.load(std::memory_order_relaxed) * 1000.0;
+        }
+
+        void Reset()
+        {
+            ImpressionCount.store(0, std::memory_order_relaxed);
+            RevenueNanos.store(0, std::memory_order_relaxed);
+            RollingRevenue.store(0.0, std::memory_order_relaxed);
+        }
+    };
+
+    void SortByRevenue(TArray<FAdRevenueSummary> &Summaries)
+    {
+        Summaries.Sort([](const FAdRevenueSummary &A, const FAdRevenueSummary &B) { return A.Revenue > B.Revenue; });
+    }
+
+    // Indexed by ad unit handle, whose identifiers are interned by AppLovinMAXAdUnits
+    FRevenueTotals AdUnitTotals[FAdUnitHandle::MaxAdUnits];
+
+    /** Revenue totals keyed by strings that have no handle, i.e. network names and placements. */
+    class FKeyedRevenueTotals
+    {
+    public:
+        explicit FKeyedRevenueTotals(const TCHAR *InDescription)
+            : Description(InDescription)
+        {
+        }
+
+        void Add(const FString &Key, double Revenue)
+        {
+            const int32 Index = Keys.FindOrAdd(Key);
+            if (Index == INDEX_NONE)
+            {
+                if (!bHasWarned.exchange(true))
+                {
+                    MAX_USER_WARN("More than %d %s with revenue, revenue of additional %s will not be aggregated", MaxTrackedKeys, Description, Description);
+                }
+                return;
+            }
+
+            Totals[Index].Add(Revenue);
+        }
+
+        TArray<FAdRevenueSummary> GetSummaries() const
+        {
+            TArray<FAdRevenueSummary> Summaries;
+            for (int32 Index = 0; Index < MaxTrackedKeys; Index++)
+            {
+                Totals[Index].AddSummary(Keys.Get(Index), Summaries);
+            }
+            SortByRevenue(Summaries);
+            return Summaries;
+        }
+
+        void Reset()
+        {
+            // Keys stay interned since concurrent writers may still hold their indices
+            for (FRevenueTotals &KeyTotals : Totals)
+            {
+                KeyTotals.Reset();
+            }
+        }
+
+    private:
+        const TCHAR *Description;
+        TAppLovinMAXInternTable<MaxTrackedKeys> Keys;
+        FRevenueTotals Totals[MaxTrackedKeys];
+        std::atomic<bool> bHasWarned{false};
+    };
+
+    FKeyedRevenueTotals NetworkRevenue(TEXT("networks"));
+    FKeyedRevenueTotals PlacementRevenue(TEXT("placements"));
+} // namespace
+
+void AppLovinMAXRevenue::HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo)
+{
+    switch (Event)
+    {
+        case EAppLovinMAXEvent::BannerAdRevenuePaid:
+        case EAppLovinMAXEvent::MRecAdRevenuePaid:
+        case EAppLovinMAXEvent::InterstitialAdRevenuePaid:
+        case EAppLovinMAXEvent::RewardedAdRevenuePaid:
+            break;
+
+        default:
+            return;
+    }
+
+    // The native SDKs report unknown revenue as a negative value; count the impression without it
+    const double Revenue = FMath::IsFinite(AdInfo.Revenue) && AdInfo.Revenue > 0 ? AdInfo.Revenue : 0.0;
+
+    if (AdInfo.AdUnitHandle.IsValid())
+    {
+        AdUnitTotals[AdInfo.AdUnitHandle.Index].Add(Revenue);
+    }
+    NetworkRevenue.Add(AdInfo.NetworkName, Revenue);
+    PlacementRevenue.Add(AdInfo.Placement, Revenue);
+}
+
+TArray<FAdRevenueSummary> AppLovinMAXRevenue::GetSummariesByAdUnit()
+{
+    TArray<FAdRevenueSummary> Summaries;
+    for (int32 Index = 0; Index < FAdUnitHandle::MaxAdUnits; Index++)
+    {
+        AdUnitTotals[Index].AddSummary(AppLovinMAXAdUnits::GetIdentifier(FAdUnitHandle(Index)), Summaries);
+    }
+    SortByRevenue(Summaries);
+    return Summaries;
+}
+
+TArray<FAdRevenueSummary> AppLovinMAXRevenue::GetSummariesByNetwork()
+{
+    return NetworkRevenue.GetSummaries();
+}
+
+TArray<FAdRevenueSummary> AppLovinMAXRevenue::GetSummariesByPlacement()
+{
+    return PlacementRevenue.GetSummaries();
+}
+
+void AppLovinMAXRevenue::Reset()
+{
+    for (FRevenueTotals &Totals : AdUnitTotals)
+    {
+        Totals.Reset();
+    }
+    NetworkRevenue.Reset();
+    PlacementRevenue.Reset();
+}
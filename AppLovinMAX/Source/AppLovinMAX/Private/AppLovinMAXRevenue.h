@@ -0,0 +1,27 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdInfo.h"
+#include "AdRevenueSummary.h"
+#include "AppLovinMAXEvent.h"
+
+/**
+ * Running revenue totals per ad unit, network and placement, folded in from the revenue paid events of all ad formats.
+ * Events are recorded on the thread that forwards them from the native plugin, and summaries can be read from any thread.
+ * Ad units are keyed by their handle, and networks and placements are interned into fixed tables the first time they are seen,
+ * so recording an event does not lock or allocate.
+ */
+namespace AppLovinMAXRevenue
+{
+    /** Adds the revenue of the ad if the event is a revenue paid event. */
+    void HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo);
+
+    TArray<FAdRevenueSummary> GetSummariesByAdUnit();
+    TArray<FAdRevenueSummary> GetSummariesByNetwork();
+    TArray<FAdRevenueSummary> GetSummariesByPlacement();
+
+    /** Clears all totals. Events recorded concurrently with a reset may be partially kept. */
+    void Reset();
+} // namespace AppLovinMAXRevenue
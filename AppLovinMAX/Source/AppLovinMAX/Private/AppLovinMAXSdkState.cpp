@@ -0,0 +1,22 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXSdkState.h"
+
+FAppLovinMAXCachedFlag AppLovinMAXSdkState::HasUserConsent;
+FAppLovinMAXCachedFlag AppLovinMAXSdkState::DoNotSell;
+FAppLovinMAXCachedFlag AppLovinMAXSdkState::Tablet;
+FAppLovinMAXCachedFlag AppLovinMAXSdkState::Muted;
+FAppLovinMAXCachedFlag AppLovinMAXSdkState::VerboseLoggingEnabled;
+
+void AppLovinMAXSdkState::ApplySdkConfiguration(const FSdkConfiguration &SdkConfiguration)
+{
+    HasUserConsent.Set(SdkConfiguration.HasUserConsent);
+    DoNotSell.Set(SdkConfiguration.IsDoNotSell);
+    Tablet.Set(SdkConfiguration.IsTablet);
+}
+
+void AppLovinMAXSdkState::HandleCmpCompleted()
+{
+    HasUserConsent.Invalidate();
+    DoNotSell.Invalidate();
+}
@@ -0,0 +1,67 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SdkConfiguration.h"
+#include <atomic>
+
+/**
+ * A cached copy of a boolean SDK setting. The value is unknown until it is written by a setter or the SDK configuration,
+ * or until the first read asks the native plugin for it. Reads and writes are lock-free and safe from any thread.
+ */
+class FAppLovinMAXCachedFlag
+{
+public:
+    /** Returns the cached value, calling ReadNative to fill the cache if the value is not known yet. */
+    template <typename FuncType>
+    bool Get(FuncType &&ReadNative)
+    {
+        const int8 Cached = State.load(std::memory_order_acquire);
+        if (Cached != Unknown) return Cached == True;
+
+        const bool bValue = ReadNative();
+
+        // A setter may have written a newer value while the native plugin was being read, in which case it wins
+        int8 Expected = Unknown;
+        State.compare_exchange_strong(Expected, bValue ? True : False, std::memory_order_acq_rel);
+        return bValue;
+    }
+
+    void Set(bool bValue)
+    {
+        State.store(bValue ? True : False, std::memory_order_release);
+    }
+
+    /** Forgets the cached value so that the next read asks the native plugin again. */
+    void Invalidate()
+    {
+        State.store(Unknown, std::memory_order_release);
+    }
+
+private:
+    static constexpr int8 Unknown = -1;
+    static constexpr int8 False = 0;
+    static constexpr int8 True = 1;
+
+    std::atomic<int8> State{Unknown};
+};
+
+/**
+ * Mirrors the SDK-wide settings that only change through UAppLovinMAX setters or the SDK configuration,
+ * so that reading them (including the verbose logging check in every MAX_USER_* log) does not cross into native code.
+ */
+namespace AppLovinMAXSdkState
+{
+    extern FAppLovinMAXCachedFlag HasUserConsent;
+    extern FAppLovinMAXCachedFlag DoNotSell;
+    extern FAppLovinMAXCachedFlag Tablet;
+    extern FAppLovinMAXCachedFlag Muted;
+    extern FAppLovinMAXCachedFlag VerboseLoggingEnabled;
+
+    /** Writes the values carried by OnSdkInitializedEvent. */
+    void ApplySdkConfiguration(const FSdkConfiguration &SdkConfiguration);
+
+    /** Invalidates the privacy values, which the consent flow may have changed natively. */
+    void HandleCmpCompleted();
+} // namespace AppLovinMAXSdkState
@@ -0,0 +1,116 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXStartup.h"
+#include "AppLovinMAXLogger.h"
+#include "AppLovinMAXStats.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace
+{
+    FCriticalSection StartupLock;
+    TArray<TFunction<void()>> DeferredCalls;
+    std::atomic<bool> bIsDeferring{false};
+
+    // Set while the game thread replays the deferred calls, so that the UAppLovinMAX calls they make go through instead of being deferred again
+    std::atomic<bool> bIsReplayingDeferredCalls{false};
+
+    // 0 until the first Initialize or InitializeAsync call
+    std::atomic<uint64> SdkInitializeStartCycles{0};
+
+    float GetMillisecondsSince(uint64 StartCycles)
+    {
+        return (float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+    }
+} // namespace
+
+bool AppLovinMAXStartup::IsDeferring()
+{
+    return bIsDeferring.load(std::memory_order_relaxed);
+}
+
+bool AppLovinMAXStartup::TryBeginDeferring()
+{
+    FScopeLock ScopeLock(&StartupLock);
+    if (bIsDeferring) return false;
+
+    bIsDeferring = true;
+    return true;
+}
+
+bool AppLovinMAXStartup::DeferCall(const TFunction<void()> &Call)
+{
+    // Calls from other threads keep being queued behind the ones being replayed
+    if (bIsReplayingDeferredCalls && IsInGameThread()) return false;
+
+    FScopeLock ScopeLock(&StartupLock);
+    if (!bIsDeferring) return false;
+
+    DeferredCalls.Add(Call);
+    INC_DWORD_STAT(STAT_AppLovinMAX_DeferredCalls);
+    return true;
+}
+
+void AppLovinMAXStartup::FinishDeferring()
+{
+    check(IsInGameThread());
+    bIsReplayingDeferredCalls = true;
+
+    int32 ReplayedCount = 0;
+    TArray<TFunction<void()>> Calls;
+    while (true)
+    {
+        {
+            FScopeLock ScopeLock(&StartupLock);
+            if (DeferredCalls.IsEmpty())
+            {
+                // Stop deferring under the lock, so that a call is either replayed here or made directly by its caller
+                bIsDeferring = false;
+                break;
+            }
+            Calls = MoveTemp(DeferredCalls);
+            DeferredCalls.Reset();
+        }
+
+        for (const TFunction<void()> &Call : Calls)
+        {
+            Call();
+        }
+        ReplayedCount += Calls.Num();
+    }
+
+    bIsReplayingDeferredCalls = false;
+
+    SET_DWORD_STAT(STAT_AppLovinMAX_DeferredCalls, 0);
+    MAX_USER_DEBUG("Replayed %d MAX calls made during initialization", ReplayedCount);
+}
+
+void AppLovinMAXStartup::RecordInitializeCall(uint64 StartCycles)
+{
+    uint64 ExpectedCycles = 0;
+    SdkInitializeStartCycles.compare_exchange_strong(ExpectedCycles, StartCycles);
+
+    const float Milliseconds = GetMillisecondsSince(StartCycles);
+    SET_FLOAT_STAT(STAT_AppLovinMAX_InitializeCall, Milliseconds);
+    CSV_CUSTOM_STAT(AppLovinMAX, InitializeCall, Milliseconds, ECsvCustomStatOp::Set);
+}
+
+void AppLovinMAXStartup::RecordPluginStartup(uint64 StartCycles)
+{
+    const float Milliseconds = GetMillisecondsSince(StartCycles);
+    SET_FLOAT_STAT(STAT_AppLovinMAX_PluginStartup, Milliseconds);
+    CSV_CUSTOM_STAT(AppLovinMAX, PluginStartup, Milliseconds, ECsvCustomStatOp::Set);
+    MAX_USER_DEBUG("Created the MAX native plugin in %.2f ms", Milliseconds);
+}
+
+void AppLovinMAXStartup::HandleSdkInitialized()
+{
+    // Only the first SDK initialized event after an Initialize call is timed
+    const uint64 StartCycles = SdkInitializeStartCycles.exchange(0);
+    if (StartCycles == 0) return;
+
+    const float Milliseconds = GetMillisecondsSince(StartCycles);
+    SET_FLOAT_STAT(STAT_AppLovinMAX_SdkInitialization, Milliseconds);
+    CSV_CUSTOM_STAT(AppLovinMAX, SdkInitialization, Milliseconds, ECsvCustomStatOp::Set);
+    MAX_USER_DEBUG("MAX SDK initialized %.2f ms after the first Initialize call", Milliseconds);
+}
@@ -0,0 +1,41 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Defers a void UAppLovinMAX call while UAppLovinMAX::InitializeAsync is still creating the native plugin, e.g. MAX_DEFER_UNTIL_INITIALIZED(ShowBanner, AdUnit).
+// The arguments are copied and the call is replayed with them once the plugin is ready. Must come first in the method, before any of its side effects.
+#define MAX_DEFER_UNTIL_INITIALIZED(Function, ...) \
+    if (AppLovinMAXStartup::IsDeferring() && AppLovinMAXStartup::DeferCall([=]() { UAppLovinMAX::Function(__VA_ARGS__); })) return
+
+/**
+ * Bookkeeping for UAppLovinMAX::InitializeAsync: the bridge calls made while the native plugin is being created in the background,
+ * and the startup timings shown by `stat AppLovinMAX` and recorded in the AppLovinMAX CSV profiler category.
+ */
+namespace AppLovinMAXStartup
+{
+    /** Returns true while calls are being deferred. Cheap enough to check on every bridge call. */
+    bool IsDeferring();
+
+    /** Starts deferring calls. Returns false if an asynchronous initialization is already deferring them. */
+    bool TryBeginDeferring();
+
+    /**
+     * Queues a call to be replayed in order once the plugin is ready. Returns false, without queuing, if calls are not being deferred
+     * or if called while replaying, in which case the caller makes the call itself.
+     */
+    bool DeferCall(const TFunction<void()> &Call);
+
+    /** Replays the deferred calls in order on the game thread, including any queued during the replay, then stops deferring. */
+    void FinishDeferring();
+
+    /** Records the time the caller spent in Initialize or InitializeAsync. The first call also starts the SDK initialization timer. */
+    void RecordInitializeCall(uint64 StartCycles);
+
+    /** Records the time spent creating and initializing the native plugin in the background. */
+    void RecordPluginStartup(uint64 StartCycles);
+
+    /** Records the time from the first Initialize or InitializeAsync call to the SDK initialized event. Safe to call from any thread. */
+    void HandleSdkInitialized();
+} // namespace AppLovinMAXStartup
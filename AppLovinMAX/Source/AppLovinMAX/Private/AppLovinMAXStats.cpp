@@ -0,0 +1,103 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXStats.h"
+#include "AppLovinMAXDelegate.h"
+#include "Containers/Ticker.h"
+
+DEFINE_STAT(STAT_AppLovinMAX_DecodeEvent);
+DEFINE_STAT(STAT_AppLovinMAX_BroadcastEvents);
+DEFINE_STAT(STAT_AppLovinMAX_EventsReceived);
+DEFINE_STAT(STAT_AppLovinMAX_LiveDelegates);
+DEFINE_STAT(STAT_AppLovinMAX_QueuedEvents);
+DEFINE_STAT(STAT_AppLovinMAX_PendingTasks);
+DEFINE_STAT(STAT_AppLovinMAX_DeferredCalls);
+DEFINE_STAT(STAT_AppLovinMAX_InitializeCall);
+DEFINE_STAT(STAT_AppLovinMAX_PluginStartup);
+DEFINE_STAT(STAT_AppLovinMAX_SdkInitialization);
+
+CSV_DEFINE_CATEGORY(AppLovinMAX, true);
+
+namespace
+{
+    constexpr int32 EventCount = (int32)EAppLovinMAXEvent::Count;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    bool Tick(float DeltaTime)
+    {
+        const int32 LiveDelegates = UAppLovinMAXDelegate::GetRegisteredDelegateCount();
+        const int32 QueuedEvents = UAppLovinMAXDelegate::GetQueuedEventCount();
+        const int32 PendingTasks = UAppLovinMAXDelegate::GetPendingTaskCount();
+
+        SET_DWORD_STAT(STAT_AppLovinMAX_LiveDelegates, LiveDelegates);
+        SET_DWORD_STAT(STAT_AppLovinMAX_QueuedEvents, QueuedEvents);
+        SET_DWORD_STAT(STAT_AppLovinMAX_PendingTasks, PendingTasks);
+
+        CSV_CUSTOM_STAT(AppLovinMAX, LiveDelegates, LiveDelegates, ECsvCustomStatOp::Set);
+        CSV_CUSTOM_STAT(AppLovinMAX, QueuedEvents, QueuedEvents, ECsvCustomStatOp::Set);
+        CSV_CUSTOM_STAT(AppLovinMAX, PendingTasks, PendingTasks, ECsvCustomStatOp::Set);
+
+        return true;
+    }
+
+#if STATS
+    // Dynamic stats so that each event type gets its own counter without declaring one per event
+    const TStatId &GetEventStatId(EAppLovinMAXEvent Event)
+    {
+        static const TArray<TStatId> StatIds = []()
+        {
+            TArray<TStatId> Result;
+            Result.Reserve(EventCount);
+            for (int32 Index = 0; Index < EventCount; Index++)
+            {
+                const FName StatName(FString::Printf(TEXT("Events Received: %s"), AppLovinMAXEvent::ToName((EAppLovinMAXEvent)Index)));
+                Result.Add(FDynamicStats::CreateStatIdInt64<FStatGroup_STATGROUP_AppLovinMAX>(StatName));
+            }
+            return Result;
+        }();
+        return StatIds[(int32)Event];
+    }
+#endif
+
+#if CSV_PROFILER
+    const FName &GetEventCsvStatName(EAppLovinMAXEvent Event)
+    {
+        static const TArray<FName> StatNames = []()
+        {
+            TArray<FName> Result;
+            Result.Reserve(EventCount);
+            for (int32 Index = 0; Index < EventCount; Index++)
+            {
+                Result.Add(FName(AppLovinMAXEvent::ToName((EAppLovinMAXEvent)Index)));
+            }
+            return Result;
+        }();
+        return StatNames[(int32)Event];
+    }
+#endif
+} // namespace
+
+void AppLovinMAXStats::RecordEventReceived(EAppLovinMAXEvent Event)
+{
+    INC_DWORD_STAT(STAT_AppLovinMAX_EventsReceived);
+
+    if (Event >= EAppLovinMAXEvent::Count) return;
+
+#if STATS
+    INC_DWORD_STAT_FNAME_BY(GetEventStatId(Event).GetName(), 1);
+#endif
+
+#if CSV_PROFILER
+    FCsvProfiler::RecordCustomStat(GetEventCsvStatName(Event), CSV_CATEGORY_INDEX(AppLovinMAX), 1, ECsvCustomStatOp::Accumulate);
+#endif
+}
+
+void AppLovinMAXStats::Startup()
+{
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&Tick));
+}
+
+void AppLovinMAXStats::Shutdown()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
@@ -0,0 +1,69 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AppLovinMAXEvent.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+/**
+ * Per-frame cost of the ad integration, shown by `stat AppLovinMAX` and recorded in the AppLovinMAX CSV profiler category.
+ * Bridge calls are counted and timed per UAppLovinMAX method by MAX_TRACE_BRIDGE_CALL, and received events are counted per event type.
+ * The startup timings are set once per initialization rather than per frame.
+ */
+DECLARE_STATS_GROUP(TEXT("AppLovinMAX"), STATGROUP_AppLovinMAX, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Decode Event"), STAT_AppLovinMAX_DecodeEvent, STATGROUP_AppLovinMAX, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Broadcast Events (Game Thread)"), STAT_AppLovinMAX_BroadcastEvents, STATGROUP_AppLovinMAX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Events Received"), STAT_AppLovinMAX_EventsReceived, STATGROUP_AppLovinMAX, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Delegate Components"), STAT_AppLovinMAX_LiveDelegates, STATGROUP_AppLovinMAX, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Queued Events"), STAT_AppLovinMAX_QueuedEvents, STATGROUP_AppLovinMAX, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Game Thread Tasks"), STAT_AppLovinMAX_PendingTasks, STATGROUP_AppLovinMAX, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Calls Deferred Until Initialized"), STAT_AppLovinMAX_DeferredCalls, STATGROUP_AppLovinMAX, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Initialize Call (ms)"), STAT_AppLovinMAX_InitializeCall, STATGROUP_AppLovinMAX, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Plugin Startup (ms)"), STAT_AppLovinMAX_PluginStartup, STATGROUP_AppLovinMAX, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("SDK Initialization (ms)"), STAT_AppLovinMAX_SdkInitialization, STATGROUP_AppLovinMAX, );
+
+CSV_DECLARE_CATEGORY_EXTERN(AppLovinMAX);
+
+// Counts and times a bridge call under its method name in both the stat group and the CSV category
+#define MAX_STAT_BRIDGE_CALL(Name) \
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT(#Name), STAT_AppLovinMAX_##Name, STATGROUP_AppLovinMAX); \
+    CSV_CUSTOM_STAT(AppLovinMAX, Name, 1, ECsvCustomStatOp::Accumulate)
+
+#if CSV_PROFILER
+// Accumulates the milliseconds spent in its scope into a CSV custom stat. Unlike CSV timing stats, custom stats are also captured on native plugin threads.
+#define MAX_CSV_SCOPED_TIME(Name) AppLovinMAXStats::FScopedCsvTime PREPROCESSOR_JOIN(CsvScopedTime, __LINE__)(#Name)
+#else
+#define MAX_CSV_SCOPED_TIME(Name)
+#endif
+
+namespace AppLovinMAXStats
+{
+    /** Counts an event received from the native plugin, in total and under its event name. Safe to call from any thread. */
+    void RecordEventReceived(EAppLovinMAXEvent Event);
+
+    /** Starts sampling the live delegate components, queued events and pending game thread tasks once per frame. */
+    void Startup();
+    void Shutdown();
+
+#if CSV_PROFILER
+    struct FScopedCsvTime
+    {
+        explicit FScopedCsvTime(const char *InStatName)
+            : StatName(InStatName), StartCycles(FPlatformTime::Cycles64())
+        {
+        }
+
+        ~FScopedCsvTime()
+        {
+            const float Milliseconds = (float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+            FCsvProfiler::RecordCustomStat(StatName, CSV_CATEGORY_INDEX(AppLovinMAX), Milliseconds, ECsvCustomStatOp::Accumulate);
+        }
+
+        const char *StatName;
+        uint64 StartCycles;
+    };
+#endif
+} // namespace AppLovinMAXStats
@@ -0,0 +1,27 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "AppLovinMAXTrace.h"
+
+#if PLATFORM_ANDROID
+#include <time.h>
+#endif
+
+UE_TRACE_CHANNEL_DEFINE(AppLovinMAXChannel);
+
+TRACE_DECLARE_FLOAT_COUNTER(AppLovinMAXForwardLatency, TEXT("AppLovinMAX/Forward Latency (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(AppLovinMAXDeliveryLatency, TEXT("AppLovinMAX/Delivery Latency (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(AppLovinMAXQueueLatency, TEXT("AppLovinMAX/Queue Latency (ms)"));
+
+double AppLovinMAXTrace::GetSecondsSinceNativeTimestamp(double NativeTimestamp)
+{
+    if (NativeTimestamp <= 0.0) return -1.0;
+
+#if PLATFORM_ANDROID
+    // FPlatformTime may use CLOCK_MONOTONIC_RAW, so read the clock behind System.nanoTime() directly
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (double)Now.tv_sec + (double)Now.tv_nsec / 1e9 - NativeTimestamp;
+#else
+    return -1.0;
+#endif
+}
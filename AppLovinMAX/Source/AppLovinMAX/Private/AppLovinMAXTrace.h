@@ -0,0 +1,45 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AppLovinMAXStats.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ * Unreal Insights channel for the native bridge. Enable it with -trace=cpu,counters,AppLovinMAX.
+ * Bridge calls, event decoding and the hop to the game thread show up as CPU scopes, and the time events spend between
+ * the native plugin and their delivery on the game thread is reported through the counters below.
+ */
+UE_TRACE_CHANNEL_EXTERN(AppLovinMAXChannel);
+
+/** Milliseconds from the native plugin sending an ad event to its decoding in ForwardEvent. */
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(AppLovinMAXForwardLatency);
+
+/** Milliseconds from the native plugin sending an ad event to its broadcast to the delegate components on the game thread. */
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(AppLovinMAXDeliveryLatency);
+
+/** Milliseconds an event waited in the event queue for the game thread. */
+TRACE_DECLARE_FLOAT_COUNTER_EXTERN(AppLovinMAXQueueLatency);
+
+// Scope around a UAppLovinMAX call into the native plugin, e.g. MAX_TRACE_BRIDGE_CALL(ShowInterstitial). Also counted by the stat group.
+#define MAX_TRACE_BRIDGE_CALL(Name) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("UAppLovinMAX::" #Name, AppLovinMAXChannel); \
+    MAX_STAT_BRIDGE_CALL(Name)
+
+// Scope with a literal name, e.g. MAX_TRACE_SCOPE("AppLovinMAX::ForwardEvent")
+#define MAX_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, AppLovinMAXChannel)
+
+// Scope with a name only known at runtime, such as an event name
+#define MAX_TRACE_DYNAMIC_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(Name, AppLovinMAXChannel)
+
+namespace AppLovinMAXTrace
+{
+    /**
+     * Returns the seconds that have passed since a timestamp sent by the native plugin, or a negative value if the event carries none.
+     * On Android the timestamps are System.nanoTime() in seconds, which is read here from the same monotonic clock.
+     */
+    double GetSecondsSinceNativeTimestamp(double NativeTimestamp);
+} // namespace AppLovinMAXTrace
@@ -1,22 +1,61 @@
 // Copyright AppLovin Corporation. All Rights Reserved.
 
 #include "AppLovinMAXUtils.h"
-#include "Runtime/Json/Public/Serialization/JsonSerializer.h"
-
 
 FString AppLovinMAXUtils::SerializeMap(const TMap<FString, FString> &Map)
 {
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+    FString OutputString;
+    AppendSerializedMap(OutputString, Map);
+
+    return OutputString;
+}
+
+void AppLovinMAXUtils::AppendSerializedMap(FString &Out, const TMap<FString, FString> &Map)
+{
+    Out.AppendChar(TEXT('{'));
+    bool bIsFirstEntry = true;
     for (const TPair<FString, FString> &Entry : Map)
     {
-        JsonObject->SetStringField(Entry.Key, Entry.Value);
-    }
+        if (!bIsFirstEntry)
+        {
+            Out.AppendChar(TEXT(','));
+        }
+        bIsFirstEntry = false;
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+        AppendJsonString(Out, Entry.Key);
+        Out.AppendChar(TEXT(':'));
+        AppendJsonString(Out, Entry.Value);
+    }
+    Out.AppendChar(TEXT('}'));
+}
 
-    return OutputString;
+void AppLovinMAXUtils::AppendJsonString(FString &Out, const FString &Value)
+{
+    Out.AppendChar(TEXT('"'));
+    for (const TCHAR Char : Value)
+    {
+        switch (Char)
+        {
+            case TEXT('"'):  Out += TEXT("\\\""); break;
+            case TEXT('\\'): Out += TEXT("\\\\"); break;
+            case TEXT('\b'): Out += TEXT("\\b"); break;
+            case TEXT('\f'): Out += TEXT("\\f"); break;
+            case TEXT('\n'): Out += TEXT("\\n"); break;
+            case TEXT('\r'): Out += TEXT("\\r"); break;
+            case TEXT('\t'): Out += TEXT("\\t"); break;
+            default:
+                if (Char < 0x20)
+                {
+                    Out += FString::Printf(TEXT("\\u%04x"), (uint32)Char);
+                }
+                else
+                {
+                    Out.AppendChar(Char);
+                }
+                break;
+        }
+    }
+    Out.AppendChar(TEXT('"'));
 }
 
 FString AppLovinMAXUtils::ParseColor(const FColor &Color)
@@ -9,6 +9,12 @@ namespace AppLovinMAXUtils
     /** Returns serialized JSON for a TMap. */
     FString SerializeMap(const TMap<FString, FString> &Map);
 
+    /** Appends serialized JSON for a TMap to Out, without building a JSON object first. */
+    void AppendSerializedMap(FString &Out, const TMap<FString, FString> &Map);
+
+    /** Appends Value to Out as a quoted and escaped JSON string. */
+    void AppendJsonString(FString &Out, const FString &Value);
+
     /** Returns the hexadecimal color code as #AARRGGBB for the given FColor. */
     FString ParseColor(const FColor &Color);
 } // namespace AppLovinMAXUtils
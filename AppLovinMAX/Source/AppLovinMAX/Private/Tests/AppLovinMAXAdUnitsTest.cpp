@@ -0,0 +1,70 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AppLovinMAX.h"
+#include "AppLovinMAXAdUnits.h"
+#include "Containers/Ticker.h"
+
+namespace
+{
+    constexpr auto AdUnitsTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter;
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppLovinMAXAdUnitsOverflowTest, "AppLovinMAX.AdUnits.Overflow", AdUnitsTestFlags)
+
+bool FAppLovinMAXAdUnitsOverflowTest::RunTest(const FString &Parameters)
+{
+    // The registry lives for the whole process, so this fills whatever room earlier tests left. Later ad units then take the identifier path.
+    FString FirstIdentifier;
+    FAdUnitHandle FirstHandle;
+    FString OverflowIdentifier;
+    for (int32 Index = 0; Index <= FAdUnitHandle::MaxAdUnits; Index++)
+    {
+        const FString Identifier = FString::Printf(TEXT("overflow_test_%d"), Index);
+        const FAdUnitHandle Handle = AppLovinMAXAdUnits::Register(Identifier);
+        if (!Handle.IsValid())
+        {
+            OverflowIdentifier = Identifier;
+            break;
+        }
+
+        if (FirstIdentifier.IsEmpty())
+        {
+            FirstIdentifier = Identifier;
+            FirstHandle = Handle;
+        }
+    }
+
+    if (!TestFalse(TEXT("Registry overflowed"), OverflowIdentifier.IsEmpty())) return false;
+    TestFalse(TEXT("Overflowed ad unit stays unregistered"), AppLovinMAXAdUnits::Register(OverflowIdentifier).IsValid());
+    if (!FirstIdentifier.IsEmpty())
+    {
+        TestEqual(TEXT("Registered ad unit keeps its handle"), AppLovinMAXAdUnits::Register(FirstIdentifier).Index, FirstHandle.Index);
+    }
+
+#if !PLATFORM_IOS && !PLATFORM_ANDROID
+    // Calls by identifier still reach the native plugin, here the mock backend
+    FAppLovinMAXMockSettings MockSettings;
+    MockSettings.bEnabled = true;
+    MockSettings.FillRate = 1.0f;
+    MockSettings.LoadLatency = 0.0f;
+    MockSettings.LoadLatencyJitter = 0.0f;
+    UAppLovinMAX::SetMockSettings(MockSettings);
+
+    UAppLovinMAX::LoadInterstitial(OverflowIdentifier);
+    FTSTicker::GetCoreTicker().Tick(0.1f);
+    TestTrue(TEXT("Overflowed interstitial is ready"), UAppLovinMAX::IsInterstitialReady(OverflowIdentifier));
+
+    UAppLovinMAX::DestroyInterstitial(OverflowIdentifier);
+    TestFalse(TEXT("Overflowed interstitial is destroyed"), UAppLovinMAX::IsInterstitialReady(OverflowIdentifier));
+
+    UAppLovinMAX::SetMockSettings(FAppLovinMAXMockSettings());
+#endif
+    return true;
+}
+
+#endif
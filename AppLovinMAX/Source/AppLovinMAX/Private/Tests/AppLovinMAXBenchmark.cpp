@@ -0,0 +1,325 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "Tests/AppLovinMAXBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "AppLovinMAXDelegate.h"
+#include "AppLovinMAXEventBatch.h"
+#include "AppLovinMAXEventDecoder.h"
+#include "AppLovinMAXLogger.h"
+#include "AppLovinMAXUtils.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Components/SceneComponent.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTime.h"
+#include "JsonObjectConverter.h"
+#include "Serialization/JsonSerializer.h"
+
+// Defined in AppLovinMAX.cpp
+void ForwardEvent(const FString &Name, const FString &Body);
+
+namespace
+{
+    // Bodies in the format sent by MaxUnrealPlugin.java and MAUnrealPlugin.mm
+    const TCHAR *const BannerAdBody = TEXT("{\"adUnitIdentifier\":\"b1a2c3d4e5f60718\",\"creativeIdentifier\":\"62331875\",\"networkName\":\"AppLovin\",\"placement\":\"\",\"revenue\":0.00042}");
+    const TCHAR *const MRecAdBody = TEXT("{\"adUnitIdentifier\":\"m1a2c3d4e5f60718\",\"creativeIdentifier\":\"58213377\",\"networkName\":\"Google AdMob\",\"placement\":\"\",\"revenue\":0.00113}");
+    const TCHAR *const InterstitialAdBody = TEXT("{\"adUnitIdentifier\":\"i1a2c3d4e5f60718\",\"creativeIdentifier\":\"71523904\",\"networkName\":\"Unity Ads\",\"placement\":\"level_end\",\"revenue\":0.0121}");
+    const TCHAR *const RewardedAdBody = TEXT("{\"adUnitIdentifier\":\"r1a2c3d4e5f60718\",\"creativeIdentifier\":\"90213566\",\"networkName\":\"ironSource\",\"placement\":\"extra_life\",\"revenue\":0.0237}");
+    const TCHAR *const InterstitialAdLoadFailedBody = TEXT("{\"adUnitIdentifier\":\"i1a2c3d4e5f60718\",\"code\":204,\"message\":\"No Fill\",\"waterfallData\":\"1\\u001fDefault\\u001fControl\\u001f1742\\u001e2\\u001f1\\u001f310\\u001f204\\u001fAppLovin\\u001fNo Fill\\u001e2\\u001f0\\u001f1432\\u001f3\\u001fGoogle AdMob\\u001fNo fill.\"}");
+
+    // Allocator calls made so far by the whole process. Counted by the engine allocators in non-shipping builds.
+    uint64 GetAllocationCalls()
+    {
+        return FMalloc::TotalMallocCalls.load(std::memory_order_relaxed) + FMalloc::TotalReallocCalls.load(std::memory_order_relaxed);
+    }
+
+    // The decoding that ForwardEvent used before AppLovinMAXEventDecoder: an FJsonObjectConverter pass per struct, including FAdError for every event
+    void DecodeWithJsonObjectConverter(const FString &Body, FAdInfo &OutAdInfo, FAdError &OutAdError)
+    {
+        FJsonObjectConverter::JsonObjectStringToUStruct<FAdInfo>(Body, &OutAdInfo, 0, 0);
+        FJsonObjectConverter::JsonObjectStringToUStruct<FAdError>(Body, &OutAdError, 0, 0);
+    }
+
+    // The JSON object based serialization that TrackEvent used before events were written with AppLovinMAXUtils::AppendSerializedMap
+    FString SerializeMapWithJsonObject(const TMap<FString, FString> &Map)
+    {
+        TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+        for (const TPair<FString, FString> &Entry : Map)
+        {
+            JsonObject->SetStringField(Entry.Key, Entry.Value);
+        }
+
+        FString OutputString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+        FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+        return OutputString;
+    }
+
+    // Live object counts for the BroadcastObjectCount scenario, up to the size of an open world level
+    const int32 BroadcastObjectCounts[] = {0, 10000, 100000};
+
+    // Objects that are not delegate components, kept alive until they are released
+    TArray<UObject *> SpawnUnrelatedObjects(int32 Count)
+    {
+        TArray<UObject *> Objects;
+        Objects.Reserve(Count);
+        for (int32 Index = 0; Index < Count; Index++)
+        {
+            UObject *Object = NewObject<USceneComponent>(GetTransientPackage());
+            Object->AddToRoot();
+            Objects.Add(Object);
+        }
+        return Objects;
+    }
+
+    void ReleaseUnrelatedObjects(const TArray<UObject *> &Objects)
+    {
+        for (UObject *Object : Objects)
+        {
+            Object->RemoveFromRoot();
+            Object->MarkAsGarbage();
+        }
+    }
+
+    double CyclesToMicroseconds(uint64 Cycles)
+    {
+        return FPlatformTime::ToMilliseconds64(Cycles) * 1000.0;
+    }
+
+    void RunBenchmarkCommand(const TArray<FString> &Args)
+    {
+        const FString Scenario = Args.IsValidIndex(0) ? Args[0] : TEXT("All");
+        const int32 Count = Args.IsValidIndex(1) ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10000;
+        const int32 EventsPerFrame = Args.IsValidIndex(2) ? FMath::Max(1, FCString::Atoi(*Args[2])) : 1;
+
+        const TArray<AppLovinMAXBenchmark::FScenarioResult> Results = AppLovinMAXBenchmark::RunScenarios(Scenario, Count, EventsPerFrame);
+        if (Results.IsEmpty())
+        {
+            MAX_W("Unknown benchmark scenario: %s. Expected All, %s.", *Scenario, *FString::Join(AppLovinMAXBenchmark::GetScenarioNames(), TEXT(", ")));
+            return;
+        }
+
+        for (const AppLovinMAXBenchmark::FScenarioResult &Result : Results)
+        {
+            for (const FString &Line : Result.ToLines())
+            {
+                MAX_D("%s", *Line);
+            }
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkCommand(
+        TEXT("AppLovinMAX.Benchmark"),
+        TEXT("Runs events through the AppLovin MAX event pipeline and logs latency percentiles, allocations and game thread time.\n")
+        TEXT("Events are broadcast to the registered delegates. Usage: AppLovinMAX.Benchmark [All|<Scenario>] [Count=10000] [EventsPerFrame=1]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmarkCommand));
+} // namespace
+
+TArray<FString> AppLovinMAXBenchmark::FScenarioResult::ToLines() const
+{
+    return {
+        FString::Printf(TEXT("%s: %d events, %d per frame"), *Name, Count, EventsPerFrame),
+        FString::Printf(TEXT("  Latency (us): p50 %.2f, p90 %.2f, p99 %.2f, max %.2f"), P50Microseconds, P90Microseconds, P99Microseconds, MaxMicroseconds),
+        FString::Printf(TEXT("  Allocations per event: %.2f"), AllocationsPerEvent),
+        FString::Printf(TEXT("  Game thread broadcast time: %.3f ms total, %.2f us per event"), DrainMilliseconds, DrainMilliseconds * 1000.0 / Count)
+    };
+}
+
+AppLovinMAXBenchmark::FScenarioResult AppLovinMAXBenchmark::RunScenario(const TCHAR *Name, int32 Count, int32 EventsPerFrame, TFunctionRef<void(int32 Index)> RunEvent)
+{
+    check(IsInGameThread());
+
+    // Start from an empty queue so that earlier events do not count towards this scenario
+    FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+    TArray<uint64> EventCycles;
+    EventCycles.Reserve(Count);
+    uint64 DrainCycles = 0;
+
+    const uint64 StartAllocationCalls = GetAllocationCalls();
+
+    for (int32 Index = 0; Index < Count; Index++)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        RunEvent(Index);
+        EventCycles.Add(FPlatformTime::Cycles64() - StartCycles);
+
+        if ((Index + 1) % EventsPerFrame == 0 || Index + 1 == Count)
+        {
+            const uint64 DrainStartCycles = FPlatformTime::Cycles64();
+            FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+            DrainCycles += FPlatformTime::Cycles64() - DrainStartCycles;
+        }
+    }
+
+    const uint64 AllocationCalls = GetAllocationCalls() - StartAllocationCalls;
+
+    EventCycles.Sort();
+    auto Percentile = [&EventCycles](double Fraction)
+    {
+        const int32 Index = FMath::Clamp(FMath::CeilToInt(Fraction * EventCycles.Num()) - 1, 0, EventCycles.Num() - 1);
+        return CyclesToMicroseconds(EventCycles[Index]);
+    };
+
+    FScenarioResult Result;
+    Result.Name = Name;
+    Result.Count = Count;
+    Result.EventsPerFrame = EventsPerFrame;
+    Result.P50Microseconds = Percentile(0.5);
+    Result.P90Microseconds = Percentile(0.9);
+    Result.P99Microseconds = Percentile(0.99);
+    Result.MaxMicroseconds = CyclesToMicroseconds(EventCycles.Last());
+    Result.AllocationsPerEvent = (double)AllocationCalls / Count;
+    Result.DrainMilliseconds = CyclesToMicroseconds(DrainCycles) / 1000.0;
+    return Result;
+}
+
+const TArray<FString> &AppLovinMAXBenchmark::GetScenarioNames()
+{
+    static const TArray<FString> ScenarioNames = {
+        TEXT("BannerRefresh"),
+        TEXT("RevenueBurst"),
+        TEXT("Broadcast"),
+        TEXT("BroadcastObjectCount"),
+        TEXT("SerializeMap"),
+        TEXT("SerializeMapJsonObject"),
+        TEXT("TrackEventBatched"),
+        TEXT("DecodeSinglePass"),
+        TEXT("DecodeJsonObjectConverter")
+    };
+    return ScenarioNames;
+}
+
+TArray<AppLovinMAXBenchmark::FScenarioResult> AppLovinMAXBenchmark::RunScenarios(const FString &Scenario, int32 Count, int32 EventsPerFrame)
+{
+    const bool bRunAll = Scenario.Equals(TEXT("All"), ESearchCase::IgnoreCase);
+    auto ShouldRun = [&Scenario, bRunAll](const TCHAR *ScenarioName)
+    {
+        return bRunAll || Scenario.Equals(ScenarioName, ESearchCase::IgnoreCase);
+    };
+
+    // Build inputs up front so that their allocations are not counted
+    const FString BannerBody = BannerAdBody;
+    const FString RevenueBodies[] = {BannerAdBody, MRecAdBody, InterstitialAdBody, RewardedAdBody};
+    const FString RevenueEventNames[] = {TEXT("OnBannerAdRevenuePaidEvent"), TEXT("OnMRecAdRevenuePaidEvent"), TEXT("OnInterstitialAdRevenuePaidEvent"), TEXT("OnRewardedAdRevenuePaidEvent")};
+    const FString BannerLoadedEventName = TEXT("OnBannerAdLoadedEvent");
+
+    // Every other decoded body is a load failure with a waterfall, as in waterfall-heavy sessions
+    const FString DecodeBodies[] = {InterstitialAdBody, InterstitialAdLoadFailedBody};
+
+    FAdInfo AdInfo;
+    AdInfo.AdUnitIdentifier = TEXT("b1a2c3d4e5f60718");
+    AdInfo.NetworkName = TEXT("AppLovin");
+    AdInfo.CreativeIdentifier = TEXT("62331875");
+    AdInfo.Revenue = 0.00042;
+
+    TMap<FString, FString> Parameters;
+    Parameters.Add(TEXT("level"), TEXT("12"));
+    Parameters.Add(TEXT("score"), TEXT("48210"));
+    Parameters.Add(TEXT("character"), TEXT("ranger"));
+    Parameters.Add(TEXT("difficulty"), TEXT("hard"));
+
+    TArray<FScenarioResult> Results;
+
+    // A banner refresh forwards a load followed by a revenue event
+    if (ShouldRun(TEXT("BannerRefresh")))
+    {
+        Results.Add(RunScenario(TEXT("BannerRefresh (ForwardEvent)"), Count, EventsPerFrame, [&](int32 Index)
+        {
+            ForwardEvent(Index % 2 == 0 ? BannerLoadedEventName : RevenueEventNames[0], BannerBody);
+        }));
+    }
+
+    if (ShouldRun(TEXT("RevenueBurst")))
+    {
+        Results.Add(RunScenario(TEXT("RevenueBurst (ForwardEvent)"), Count, EventsPerFrame, [&](int32 Index)
+        {
+            ForwardEvent(RevenueEventNames[Index % 4], RevenueBodies[Index % 4]);
+        }));
+    }
+
+    if (ShouldRun(TEXT("Broadcast")))
+    {
+        Results.Add(RunScenario(TEXT("Broadcast (UAppLovinMAXDelegate::BroadcastAdEvent)"), Count, EventsPerFrame, [&](int32 Index)
+        {
+            UAppLovinMAXDelegate::BroadcastAdEvent(EAppLovinMAXEvent::BannerAdRevenuePaid, AdInfo);
+        }));
+    }
+
+    // The broadcast above with more and more unrelated objects alive, whose cost should not grow with the object count
+    if (ShouldRun(TEXT("BroadcastObjectCount")))
+    {
+        for (const int32 ObjectCount : BroadcastObjectCounts)
+        {
+            const TArray<UObject *> Objects = SpawnUnrelatedObjects(ObjectCount);
+
+            const FString Name = FString::Printf(TEXT("BroadcastObjectCount (UAppLovinMAXDelegate::BroadcastAdEvent with %d more objects)"), ObjectCount);
+            Results.Add(RunScenario(*Name, Count, EventsPerFrame, [&](int32 Index)
+            {
+                UAppLovinMAXDelegate::BroadcastAdEvent(EAppLovinMAXEvent::BannerAdRevenuePaid, AdInfo);
+            }));
+
+            ReleaseUnrelatedObjects(Objects);
+        }
+    }
+
+    if (ShouldRun(TEXT("SerializeMap")))
+    {
+        Results.Add(RunScenario(TEXT("SerializeMap (AppLovinMAXUtils::SerializeMap)"), Count, EventsPerFrame, [&](int32 Index)
+        {
+            AppLovinMAXUtils::SerializeMap(Parameters);
+        }));
+    }
+
+    // Baseline for the two scenarios above and below
+    if (ShouldRun(TEXT("SerializeMapJsonObject")))
+    {
+        Results.Add(RunScenario(TEXT("SerializeMapJsonObject (FJsonObject and TJsonWriter)"), Count, EventsPerFrame, [&](int32 Index)
+        {
+            SerializeMapWithJsonObject(Parameters);
+        }));
+    }
+
+    // Events are flushed once per frame to a callback that drops them, so this measures everything but the native call
+    if (ShouldRun(TEXT("TrackEventBatched")))
+    {
+        const FString EventName = TEXT("level_complete");
+        FAppLovinMAXEventBatch EventBatch([](const FString &SerializedEvents) {});
+        EventBatch.SetLimits(EventsPerFrame, 0.0);
+
+        Results.Add(RunScenario(TEXT("TrackEventBatched (FAppLovinMAXEventBatch)"), Count, EventsPerFrame, [&](int32 Index)
+        {
+            EventBatch.Add(EventName, Parameters);
+        }));
+    }
+
+    // Both decoders run on the same bodies. The single pass decoder only decodes the FAdError of the failure, like ForwardEvent.
+    if (ShouldRun(TEXT("DecodeSinglePass")))
+    {
+        Results.Add(RunScenario(TEXT("DecodeSinglePass (AppLovinMAXEventDecoder::DecodeAdEvent)"), Count, EventsPerFrame, [&](int32 Index)
+        {
+            FAdInfo DecodedAdInfo;
+            FAdError DecodedAdError;
+            AppLovinMAXEventDecoder::DecodeAdEvent(DecodeBodies[Index % 2], DecodedAdInfo, Index % 2 == 1 ? &DecodedAdError : nullptr);
+        }));
+    }
+
+    // Baseline for the scenario above
+    if (ShouldRun(TEXT("DecodeJsonObjectConverter")))
+    {
+        Results.Add(RunScenario(TEXT("DecodeJsonObjectConverter (FJsonObjectConverter::JsonObjectStringToUStruct)"), Count, EventsPerFrame, [&](int32 Index)
+        {
+            FAdInfo DecodedAdInfo;
+            FAdError DecodedAdError;
+            DecodeWithJsonObjectConverter(DecodeBodies[Index % 2], DecodedAdInfo, DecodedAdError);
+        }));
+    }
+
+    return Results;
+}
+
+#endif
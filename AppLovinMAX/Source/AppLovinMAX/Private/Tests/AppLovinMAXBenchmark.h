@@ -0,0 +1,53 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Micro-benchmarks of the event pipeline, run by the AppLovinMAX.Benchmark automation tests and the AppLovinMAX.Benchmark console command.
+ * Scenarios replay recorded event bodies through ForwardEvent, the event decoders, UAppLovinMAXDelegate::BroadcastAdEvent and the event serialization,
+ * and do not need a renderer, so they run headless, e.g.
+ * UnrealEditor-Cmd <Project> -ExecCmds="Automation RunTests AppLovinMAX.Benchmark; Quit" -nullrhi -unattended
+ */
+namespace AppLovinMAXBenchmark
+{
+    struct FScenarioResult
+    {
+        FString Name;
+        int32 Count = 0;
+        int32 EventsPerFrame = 0;
+        double P50Microseconds = 0;
+        double P90Microseconds = 0;
+        double P99Microseconds = 0;
+        double MaxMicroseconds = 0;
+
+        /** Calls to the allocator per event, counted process wide, so allocations made by other threads at the same time are included. */
+        double AllocationsPerEvent = 0;
+
+        /** Game thread time spent running the tasks queued by the events, i.e. broadcasting them to the delegate components. */
+        double DrainMilliseconds = 0;
+
+        /** Returns the result as log lines. */
+        TArray<FString> ToLines() const;
+    };
+
+    /**
+     * Runs Count events through RunEvent on the game thread and measures per-event latency, allocations and game thread time.
+     * Queued game thread tasks are drained after every EventsPerFrame events, like a frame would.
+     */
+    FScenarioResult RunScenario(const TCHAR *Name, int32 Count, int32 EventsPerFrame, TFunctionRef<void(int32 Index)> RunEvent);
+
+    /** Returns the names of the scenarios that RunScenarios accepts, besides All. */
+    const TArray<FString> &GetScenarioNames();
+
+    /**
+     * Runs the named scenario, or every scenario for All, on the game thread.
+     * @return The results, one per scenario and size for scenarios that run at several sizes, or none if the scenario is unknown.
+     */
+    TArray<FScenarioResult> RunScenarios(const FString &Scenario, int32 Count, int32 EventsPerFrame);
+} // namespace AppLovinMAXBenchmark
+
+#endif
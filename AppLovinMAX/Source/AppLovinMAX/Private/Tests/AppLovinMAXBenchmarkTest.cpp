@@ -0,0 +1,54 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/AppLovinMAXBenchmark.h"
+
+namespace
+{
+    constexpr int32 BenchmarkEventCount = 10000;
+
+    // Runs one scenario and reports its metrics as test info, so that they show up in the automation report
+    bool RunBenchmarkScenario(FAutomationTestBase &Test, const FString &Scenario, int32 EventsPerFrame)
+    {
+        const TArray<AppLovinMAXBenchmark::FScenarioResult> Results = AppLovinMAXBenchmark::RunScenarios(Scenario, BenchmarkEventCount, EventsPerFrame);
+        if (!Test.TestTrue(TEXT("Scenario results"), Results.Num() > 0)) return false;
+
+        // Some scenarios run at several sizes
+        for (const AppLovinMAXBenchmark::FScenarioResult &Result : Results)
+        {
+            for (const FString &Line : Result.ToLines())
+            {
+                Test.AddInfo(Line);
+            }
+        }
+        return true;
+    }
+} // namespace
+
+/**
+ * One test per scenario, e.g. AppLovinMAX.Benchmark.BannerRefresh. Each scenario runs with one event per frame and with bursts of 100 events per frame.
+ * Run headless with: UnrealEditor-Cmd <Project> -ExecCmds="Automation RunTests AppLovinMAX.Benchmark; Quit" -nullrhi -unattended
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAppLovinMAXBenchmarkTest, "AppLovinMAX.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FAppLovinMAXBenchmarkTest::GetTests(TArray<FString> &OutBeautifiedNames, TArray<FString> &OutTestCommands) const
+{
+    for (const FString &Scenario : AppLovinMAXBenchmark::GetScenarioNames())
+    {
+        OutBeautifiedNames.Add(Scenario);
+        OutTestCommands.Add(Scenario);
+    }
+}
+
+bool FAppLovinMAXBenchmarkTest::RunTest(const FString &Parameters)
+{
+    bool bSucceeded = RunBenchmarkScenario(*this, Parameters, 1);
+    bSucceeded &= RunBenchmarkScenario(*this, Parameters, 100);
+    return bSucceeded;
+}
+
+#endif
@@ -0,0 +1,189 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AppLovinMAXEventDecoder.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    constexpr auto EventDecoderTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter;
+
+    // Golden events written by Fixtures/generate_binary_event_fixtures.py in the format of MaxUnrealPlugin.BinaryEventWriter
+    bool LoadBinaryEventFixture(FAutomationTestBase &Test, const TCHAR *Name, TArray<uint8> &OutData)
+    {
+        const FString FixturesDir = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("AppLovinMAX"))->GetBaseDir(), TEXT("Source/AppLovinMAX/Private/Tests/Fixtures"));
+        const FString Path = FPaths::Combine(FixturesDir, Name);
+        return Test.TestTrue(FString::Printf(TEXT("Load %s"), *Path), FFileHelper::LoadFileToArray(OutData, *Path));
+    }
+
+    void TestInterstitialAdInfo(FAutomationTestBase &Test, const FAdInfo &AdInfo)
+    {
+        Test.TestEqual(TEXT("AdUnitIdentifier"), AdInfo.AdUnitIdentifier, TEXT("i1a2c3d4e5f60718"));
+        Test.TestEqual(TEXT("NetworkName"), AdInfo.NetworkName, TEXT("Unity Ads"));
+        Test.TestEqual(TEXT("CreativeIdentifier"), AdInfo.CreativeIdentifier, TEXT("71523904"));
+        Test.TestEqual(TEXT("Placement"), AdInfo.Placement, TEXT("level_end"));
+        Test.TestEqual(TEXT("Revenue"), AdInfo.Revenue, 0.0121);
+        Test.TestEqual(TEXT("NativeTimestamp"), AdInfo.NativeTimestamp, 81234.5);
+    }
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppLovinMAXBinaryAdLoadedTest, "AppLovinMAX.EventDecoder.Binary.AdLoaded", EventDecoderTestFlags)
+
+bool FAppLovinMAXBinaryAdLoadedTest::RunTest(const FString &Parameters)
+{
+    TArray<uint8> Data;
+    if (!LoadBinaryEventFixture(*this, TEXT("InterstitialAdLoaded.bin"), Data)) return false;
+
+    FAdInfo AdInfo;
+    FAdError AdError;
+    TestTrue(TEXT("Decoded"), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data.GetData(), Data.Num(), AdInfo, &AdError));
+    TestInterstitialAdInfo(*this, AdInfo);
+    TestFalse(TEXT("No AdUnitHandle"), AdInfo.AdUnitHandle.IsValid());
+    TestEqual(TEXT("Code"), AdError.Code, 0);
+    TestTrue(TEXT("No waterfall"), AdError.WaterfallPayload.IsEmpty());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppLovinMAXBinaryAdLoadFailedTest, "AppLovinMAX.EventDecoder.Binary.AdLoadFailed", EventDecoderTestFlags)
+
+bool FAppLovinMAXBinaryAdLoadFailedTest::RunTest(const FString &Parameters)
+{
+    TArray<uint8> Data;
+    if (!LoadBinaryEventFixture(*this, TEXT("InterstitialAdLoadFailed.bin"), Data)) return false;
+
+    FAdInfo AdInfo;
+    FAdError AdError;
+    TestTrue(TEXT("Decoded"), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data.GetData(), Data.Num(), AdInfo, &AdError));
+    TestEqual(TEXT("AdUnitIdentifier"), AdInfo.AdUnitIdentifier, TEXT("i1a2c3d4e5f60718"));
+    TestTrue(TEXT("No network"), AdInfo.NetworkName.IsEmpty());
+    TestEqual(TEXT("Code"), AdError.Code, 204);
+    TestEqual(TEXT("Message"), AdError.Message, TEXT("No Fill"));
+
+    const FAdWaterfallInfo &Waterfall = AdError.GetWaterfall();
+    TestEqual(TEXT("Waterfall.Name"), Waterfall.Name, TEXT("Default"));
+    TestEqual(TEXT("Waterfall.TestName"), Waterfall.TestName, TEXT("Control"));
+    TestEqual(TEXT("Waterfall.LatencyMillis"), Waterfall.LatencyMillis, (int64)1742);
+    if (!TestEqual(TEXT("Waterfall.NetworkResponses"), Waterfall.NetworkResponses.Num(), 2)) return false;
+
+    const FAdNetworkResponseInfo &Bidder = Waterfall.NetworkResponses[0];
+    TestEqual(TEXT("Bidder.NetworkName"), Bidder.NetworkName, TEXT("AppLovin"));
+    TestTrue(TEXT("Bidder.AdLoadState"), Bidder.AdLoadState == EAdLoadState::FailedToLoad);
+    TestTrue(TEXT("Bidder.bIsBidding"), Bidder.bIsBidding);
+    TestEqual(TEXT("Bidder.LatencyMillis"), Bidder.LatencyMillis, (int64)310);
+    TestEqual(TEXT("Bidder.ErrorCode"), Bidder.ErrorCode, 204);
+    TestEqual(TEXT("Bidder.ErrorMessage"), Bidder.ErrorMessage, TEXT("No Fill"));
+
+    const FAdNetworkResponseInfo &LineItem = Waterfall.NetworkResponses[1];
+    TestEqual(TEXT("LineItem.NetworkName"), LineItem.NetworkName, TEXT("Google AdMob"));
+    TestFalse(TEXT("LineItem.bIsBidding"), LineItem.bIsBidding);
+    TestEqual(TEXT("LineItem.LatencyMillis"), LineItem.LatencyMillis, (int64)1432);
+    TestEqual(TEXT("LineItem.ErrorCode"), LineItem.ErrorCode, 3);
+
+    // The deprecated description is only built when it is read
+    TestTrue(TEXT("Waterfall before read"), AdError.Waterfall.IsEmpty());
+    const FString &WaterfallString = AdError.GetWaterfallString();
+    TestFalse(TEXT("WaterfallString"), WaterfallString.IsEmpty());
+    TestEqual(TEXT("Waterfall after read"), AdError.Waterfall, WaterfallString);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppLovinMAXBinaryAdRewardTest, "AppLovinMAX.EventDecoder.Binary.Reward", EventDecoderTestFlags)
+
+bool FAppLovinMAXBinaryAdRewardTest::RunTest(const FString &Parameters)
+{
+    TArray<uint8> Data;
+    if (!LoadBinaryEventFixture(*this, TEXT("RewardedAdReceivedReward.bin"), Data)) return false;
+
+    FAdInfo AdInfo;
+    FAdReward Reward;
+    TestTrue(TEXT("Decoded"), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data.GetData(), Data.Num(), AdInfo, nullptr, &Reward));
+    TestEqual(TEXT("AdUnitIdentifier"), AdInfo.AdUnitIdentifier, TEXT("r1a2c3d4e5f60718"));
+    TestEqual(TEXT("AdUnitHandle"), AdInfo.AdUnitHandle.Index, 3);
+    TestEqual(TEXT("Placement"), AdInfo.Placement, TEXT("vie_suppl\u00E9mentaire"));
+    TestEqual(TEXT("Revenue"), AdInfo.Revenue, 0.0237);
+    TestEqual(TEXT("Label"), Reward.Label, TEXT("\U0001F48E gems"));
+    TestEqual(TEXT("Amount"), Reward.Amount, 25);
+
+    // Without a reward to decode into, the reward fields are skipped
+    FAdInfo AdInfoOnly;
+    TestTrue(TEXT("Decoded without reward"), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data.GetData(), Data.Num(), AdInfoOnly));
+    TestEqual(TEXT("Placement without reward"), AdInfoOnly.Placement, AdInfo.Placement);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppLovinMAXBinaryUnknownFieldsTest, "AppLovinMAX.EventDecoder.Binary.UnknownFields", EventDecoderTestFlags)
+
+bool FAppLovinMAXBinaryUnknownFieldsTest::RunTest(const FString &Parameters)
+{
+    TArray<uint8> Data;
+    if (!LoadBinaryEventFixture(*this, TEXT("UnknownFields.bin"), Data)) return false;
+
+    // Fields added by a newer writer are skipped by type
+    FAdInfo AdInfo;
+    FAdError AdError;
+    TestTrue(TEXT("Decoded"), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data.GetData(), Data.Num(), AdInfo, &AdError));
+    TestInterstitialAdInfo(*this, AdInfo);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppLovinMAXBinaryTruncatedTest, "AppLovinMAX.EventDecoder.Binary.Truncated", EventDecoderTestFlags)
+
+bool FAppLovinMAXBinaryTruncatedTest::RunTest(const FString &Parameters)
+{
+    TArray<uint8> Data;
+    if (!LoadBinaryEventFixture(*this, TEXT("Truncated.bin"), Data)) return false;
+
+    // Cut in the middle of the network name, so the fields before it are kept
+    FAdInfo AdInfo;
+    TestFalse(TEXT("Decoded"), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data.GetData(), Data.Num(), AdInfo));
+    TestEqual(TEXT("AdUnitIdentifier"), AdInfo.AdUnitIdentifier, TEXT("i1a2c3d4e5f60718"));
+    TestTrue(TEXT("No network"), AdInfo.NetworkName.IsEmpty());
+
+    // Every prefix of a complete event is rejected, wherever it is cut
+    TArray<uint8> Complete;
+    if (!LoadBinaryEventFixture(*this, TEXT("InterstitialAdLoaded.bin"), Complete)) return false;
+
+    for (int32 Length = 0; Length < Complete.Num(); Length++)
+    {
+        FAdInfo PrefixAdInfo;
+        FAdError PrefixAdError;
+        TestFalse(FString::Printf(TEXT("Decoded %d of %d bytes"), Length, Complete.Num()), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Complete.GetData(), Length, PrefixAdInfo, &PrefixAdError));
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppLovinMAXBinaryUnsupportedVersionTest, "AppLovinMAX.EventDecoder.Binary.UnsupportedVersion", EventDecoderTestFlags)
+
+bool FAppLovinMAXBinaryUnsupportedVersionTest::RunTest(const FString &Parameters)
+{
+    TArray<uint8> Data;
+    if (!LoadBinaryEventFixture(*this, TEXT("InterstitialAdLoaded.bin"), Data)) return false;
+
+    Data[0] = 2;
+
+    FAdInfo AdInfo;
+    TestFalse(TEXT("Decoded"), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data.GetData(), Data.Num(), AdInfo));
+    TestTrue(TEXT("Nothing decoded"), AdInfo.AdUnitIdentifier.IsEmpty());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppLovinMAXBinaryMismatchedTypeTest, "AppLovinMAX.EventDecoder.Binary.MismatchedType", EventDecoderTestFlags)
+
+bool FAppLovinMAXBinaryMismatchedTypeTest::RunTest(const FString &Parameters)
+{
+    // An error code tagged as a double, which would otherwise be read as an int32 and leave the rest of the double as the next tags
+    const uint8 Data[] = {1, (6 << 2) | 1, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    FAdInfo AdInfo;
+    FAdError AdError;
+    TestFalse(TEXT("Decoded"), AppLovinMAXEventDecoder::DecodeBinaryAdEvent(Data, UE_ARRAY_COUNT(Data), AdInfo, &AdError));
+    return true;
+}
+
+#endif
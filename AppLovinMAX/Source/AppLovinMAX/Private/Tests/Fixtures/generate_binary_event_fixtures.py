@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+#
+# Writes the golden binary ad event fixtures read by AppLovinMAXEventDecoderTest.cpp.
+# The encoding mirrors MaxUnrealPlugin.BinaryEventWriter byte for byte, and the events mirror sendUnrealAdEvent, so regenerate the fixtures whenever either changes.
+# Usage: ./generate_binary_event_fixtures.py
+#
+# Copyright AppLovin Corporation. All rights reserved.
+#
+
+import struct
+
+from pathlib import Path
+
+
+""" Globals """
+
+
+# NOTE: Must match MaxUnrealPlugin.BinaryEventWriter
+VERSION = 1
+
+TYPE_STRING = 0
+TYPE_DOUBLE = 1
+TYPE_INT = 2
+
+FIELD_END = 0
+FIELD_AD_UNIT_IDENTIFIER = 1
+FIELD_NETWORK_NAME = 2
+FIELD_CREATIVE_IDENTIFIER = 3
+FIELD_PLACEMENT = 4
+FIELD_REVENUE = 5
+FIELD_ERROR_CODE = 6
+FIELD_ERROR_MESSAGE = 7
+FIELD_ERROR_WATERFALL = 8
+FIELD_REWARD_LABEL = 9
+FIELD_REWARD_AMOUNT = 10
+FIELD_TIMESTAMP = 11
+FIELD_ERROR_WATERFALL_DATA = 12
+FIELD_AD_UNIT_HANDLE = 13
+
+# Fields from a newer writer, which the decoder must skip by type
+FIELD_UNKNOWN_STRING = 60
+FIELD_UNKNOWN_DOUBLE = 61
+FIELD_UNKNOWN_INT = 62
+
+# NOTE: Must match getWaterfallData in MaxUnrealPlugin.java
+WATERFALL_FIELD_SEPARATOR = "\u001F"
+WATERFALL_RECORD_SEPARATOR = "\u001E"
+
+fixtures_dir = Path(__file__).resolve().parent
+
+
+""" Classes """
+
+
+class BinaryEventWriter:
+    def __init__(self):
+        self.buffer = bytearray([VERSION])
+
+    def put_string(self, field, value):
+        encoded = value.encode("utf-8")
+        self.buffer += struct.pack("<Bi", (field << 2) | TYPE_STRING, len(encoded)) + encoded
+        return self
+
+    def put_double(self, field, value):
+        self.buffer += struct.pack("<Bd", (field << 2) | TYPE_DOUBLE, value)
+        return self
+
+    def put_int(self, field, value):
+        self.buffer += struct.pack("<Bi", (field << 2) | TYPE_INT, value)
+        return self
+
+    def end(self):
+        self.buffer.append(FIELD_END)
+        return bytes(self.buffer)
+
+
+""" Functions """
+
+
+def begin_ad_event(ad_unit_id, ad_unit_handle=None):
+    writer = BinaryEventWriter().put_double(FIELD_TIMESTAMP, 81234.5).put_string(FIELD_AD_UNIT_IDENTIFIER, ad_unit_id)
+    if ad_unit_handle is not None:
+        writer.put_int(FIELD_AD_UNIT_HANDLE, ad_unit_handle)
+    return writer
+
+
+def put_ad(writer, network_name, creative_id, placement, revenue):
+    return writer.put_string(FIELD_NETWORK_NAME, network_name) \
+        .put_string(FIELD_CREATIVE_IDENTIFIER, creative_id) \
+        .put_string(FIELD_PLACEMENT, placement) \
+        .put_double(FIELD_REVENUE, revenue)
+
+
+def get_waterfall_data():
+    header = WATERFALL_FIELD_SEPARATOR.join(["1", "Default", "Control", "1742"])
+    responses = [
+        WATERFALL_FIELD_SEPARATOR.join(["2", "1", "310", "204", "AppLovin", "No Fill"]),
+        WATERFALL_FIELD_SEPARATOR.join(["2", "0", "1432", "3", "Google AdMob", "No fill."])
+    ]
+    return WATERFALL_RECORD_SEPARATOR.join([header] + responses)
+
+
+def write_fixture(name, data):
+    (fixtures_dir / name).write_bytes(data)
+    print(f"Wrote {name} ({len(data)} bytes)")
+
+
+def main():
+    interstitial_loaded = put_ad(begin_ad_event("i1a2c3d4e5f60718"), "Unity Ads", "71523904", "level_end", 0.0121).end()
+    write_fixture("InterstitialAdLoaded.bin", interstitial_loaded)
+
+    interstitial_load_failed = begin_ad_event("i1a2c3d4e5f60718") \
+        .put_int(FIELD_ERROR_CODE, 204) \
+        .put_string(FIELD_ERROR_MESSAGE, "No Fill") \
+        .put_string(FIELD_ERROR_WATERFALL_DATA, get_waterfall_data()) \
+        .end()
+    write_fixture("InterstitialAdLoadFailed.bin", interstitial_load_failed)
+
+    # Multi-byte UTF-8 in the strings, and an ad unit handle set by Unreal
+    rewarded_ad_received_reward = put_ad(begin_ad_event("r1a2c3d4e5f60718", 3), "ironSource", "90213566", "vie_supplémentaire", 0.0237) \
+        .put_string(FIELD_REWARD_LABEL, "💎 gems") \
+        .put_int(FIELD_REWARD_AMOUNT, 25) \
+        .end()
+    write_fixture("RewardedAdReceivedReward.bin", rewarded_ad_received_reward)
+
+    unknown_fields = put_ad(begin_ad_event("i1a2c3d4e5f60718"), "Unity Ads", "71523904", "level_end", 0.0121) \
+        .put_string(FIELD_UNKNOWN_STRING, "from a newer plugin") \
+        .put_double(FIELD_UNKNOWN_DOUBLE, 1.5) \
+        .put_int(FIELD_UNKNOWN_INT, 7) \
+        .end()
+    write_fixture("UnknownFields.bin", unknown_fields)
+
+    # Cut in the middle of the network name
+    network_name_offset = interstitial_loaded.index(b"Unity Ads")
+    write_fixture("Truncated.bin", interstitial_loaded[:network_name_offset + 4])
+
+
+if __name__ == "__main__":
+    main()
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AdWaterfallInfo.h"
 #include "AdError.generated.h"
 
 USTRUCT(BlueprintType)
@@ -10,6 +11,15 @@ struct APPLOVINMAX_API FAdError
 {
     GENERATED_BODY()
 
+    /**
+     * Returns the underlying waterfall of ad responses. The waterfall is sent by the native plugin in a compact form and only parsed on the first call.
+     * Not safe to call on the same instance from several threads at once.
+     */
+    const FAdWaterfallInfo &GetWaterfall() const;
+
+    /** Returns a readable description of the waterfall for logging. Built on the first call and cached in Waterfall. Not safe to call on the same instance from several threads at once. */
+    const FString &GetWaterfallString() const;
+
     /** The error code for the error. */
     UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
     int Code = 0;
@@ -18,7 +28,14 @@ struct APPLOVINMAX_API FAdError
     UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
     FString Message;
 
-    /** The underlying waterfall of ad responses. */
-    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
-    FString Waterfall;
+    /** A description of the waterfall. Empty until GetWaterfallString() or UAppLovinMAX::GetAdErrorWaterfallString() is called, so that errors pay for it only when it is read. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX", meta = (DeprecatedProperty, DeprecationMessage = "Use GetAdErrorWaterfallString or GetAdErrorWaterfall instead."))
+    mutable FString Waterfall;
+
+    /** The waterfall as sent by the native plugin. Use GetWaterfall() to read it. */
+    FString WaterfallPayload;
+
+private:
+    // Shared by copies made after the waterfall was parsed
+    mutable TSharedPtr<const FAdWaterfallInfo> ParsedWaterfall;
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AdUnitHandle.h"
 #include "AdInfo.generated.h"
 
 USTRUCT(BlueprintType)
@@ -15,6 +16,10 @@ struct APPLOVINMAX_API FAdInfo
     UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
     FString AdUnitIdentifier;
 
+    /** Handle of the ad unit, for routing events without comparing identifiers. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    FAdUnitHandle AdUnitHandle;
+
     UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
     FString NetworkName;
 
@@ -26,4 +31,7 @@ struct APPLOVINMAX_API FAdInfo
 
     UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
     double Revenue = 0;
+
+    /** Seconds on the native plugin's monotonic clock when it sent the event, or 0 if the platform does not report it. Used for tracing. */
+    double NativeTimestamp = 0;
 };
@@ -0,0 +1,39 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdInventoryEviction.generated.h"
+
+/** Ad formats that can be evicted under memory pressure, in the order they are evicted. */
+UENUM(BlueprintType)
+enum class EAdInventoryFormat : uint8
+{
+    MRec,
+    Banner,
+    Interstitial,
+    Rewarded
+};
+
+/** An ad view or loaded fullscreen ad that was destroyed to free memory. */
+USTRUCT(BlueprintType)
+struct APPLOVINMAX_API FAdInventoryEviction
+{
+    GENERATED_BODY()
+
+    FString ToString() const;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    FString AdUnitIdentifier;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    EAdInventoryFormat AdFormat = EAdInventoryFormat::MRec;
+
+    /** Drop in used physical memory measured after the eviction, or 0 if memory did not drop. Includes anything else freed at the same time. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    int64 FreedBytes = 0;
+
+    /** Whether the ad view was re-created, or the ad reloaded, once memory pressure eased. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    bool bIsRestored = false;
+};
@@ -0,0 +1,25 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdError.h"
+#include "AdInfo.h"
+#include "AdReward.h"
+#include "Misc/TVariant.h"
+
+/**
+ * Result of an asynchronous load or show, e.g. from UAppLovinMAX::LoadInterstitialAsync. Holds the FAdInfo of a loaded or hidden ad,
+ * or the FAdError of a failed load or display. Read it with IsType<T>() and Get<T>().
+ */
+using FAdResult = TVariant<FAdInfo, FAdError>;
+
+/** Result of UAppLovinMAX::ShowRewardedAdAsync, set once the rewarded ad is hidden or failed to display. */
+struct FRewardedAdResult
+{
+    /** The FAdInfo of the hidden ad or the FAdError of the failed display. */
+    FAdResult AdResult;
+
+    /** The reward the user earned while the ad was displayed. Not valid if none was earned. */
+    FAdReward Reward;
+};
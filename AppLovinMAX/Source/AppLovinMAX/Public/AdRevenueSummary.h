@@ -0,0 +1,30 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdRevenueSummary.generated.h"
+
+USTRUCT(BlueprintType)
+struct APPLOVINMAX_API FAdRevenueSummary
+{
+    GENERATED_BODY()
+
+    FString ToString() const;
+
+    /** The ad unit identifier, network name or placement that the revenue is grouped by. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    FString Key;
+
+    /** Number of revenue paid events. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    int64 ImpressionCount = 0;
+
+    /** Total revenue in USD. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    double Revenue = 0;
+
+    /** Revenue in USD per thousand impressions, weighted towards the most recent impressions. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    double RollingEcpm = 0;
+};
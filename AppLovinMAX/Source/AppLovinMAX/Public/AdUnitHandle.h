@@ -0,0 +1,35 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdUnitHandle.generated.h"
+
+/**
+ * Small handle for an ad unit registered with UAppLovinMAX::RegisterAdUnit.
+ * Handles stay the same for the lifetime of the process and are below MaxAdUnits, so they can index a fixed size array.
+ */
+USTRUCT(BlueprintType)
+struct APPLOVINMAX_API FAdUnitHandle
+{
+    GENERATED_BODY()
+
+    static constexpr int32 MaxAdUnits = 256;
+
+    FAdUnitHandle() = default;
+
+    explicit FAdUnitHandle(int32 InIndex)
+        : Index(InIndex)
+    {
+    }
+
+    bool IsValid() const { return Index >= 0 && Index < MaxAdUnits; }
+
+    bool operator==(const FAdUnitHandle &Other) const { return Index == Other.Index; }
+    bool operator!=(const FAdUnitHandle &Other) const { return Index != Other.Index; }
+
+    friend uint32 GetTypeHash(const FAdUnitHandle &Handle) { return ::GetTypeHash(Handle.Index); }
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    int32 Index = INDEX_NONE;
+};
@@ -0,0 +1,66 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdWaterfallInfo.generated.h"
+
+// NOTE: Values must match getAdLoadStateCode in MaxUnrealPlugin.java
+UENUM(BlueprintType)
+enum class EAdLoadState : uint8
+{
+    /** The network was not attempted, e.g. because an earlier network in the waterfall filled. */
+    AdLoadNotAttempted,
+    AdLoaded,
+    FailedToLoad
+};
+
+/** The response of one mediated network in a waterfall. */
+USTRUCT(BlueprintType)
+struct APPLOVINMAX_API FAdNetworkResponseInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    FString NetworkName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    EAdLoadState AdLoadState = EAdLoadState::AdLoadNotAttempted;
+
+    /** Whether the network took part through bidding rather than as a waterfall line item. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    bool bIsBidding = false;
+
+    /** The time the network took to respond, in milliseconds. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    int64 LatencyMillis = 0;
+
+    /** The error code of the network if it failed to load, otherwise 0. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    int32 ErrorCode = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    FString ErrorMessage;
+};
+
+/** The waterfall of network responses behind an ad load. */
+USTRUCT(BlueprintType)
+struct APPLOVINMAX_API FAdWaterfallInfo
+{
+    GENERATED_BODY()
+
+    FString ToString() const;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    FString Name;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    FString TestName;
+
+    /** The time the whole waterfall took, in milliseconds. */
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    int64 LatencyMillis = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AppLovinMAX")
+    TArray<FAdNetworkResponseInfo> NetworkResponses;
+};
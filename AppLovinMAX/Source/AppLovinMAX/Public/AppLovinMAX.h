@@ -4,7 +4,16 @@
 
 #include "AdError.h"
 #include "AdInfo.h"
+#include "AdInventoryEviction.h"
+#include "AdResult.h"
+#include "AdRevenueSummary.h"
+#include "AdUnitHandle.h"
 #include "AdReward.h"
+#include "AppLovinMAXEvent.h"
+#include "AppLovinMAXMockSettings.h"
+#include "AppLovinMAXThrottleSettings.h"
+#include "Async/Future.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "CmpError.h"
 #include "SdkConfiguration.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
@@ -14,11 +23,16 @@
 #if PLATFORM_IOS
 @class MAUnrealPlugin;
 #elif PLATFORM_ANDROID
+class FAppLovinMAXAdViewCommandBuffer;
+class FAppLovinMAXEventBatch;
 class FJavaAndroidMaxUnrealPlugin;
+#else
+class FAppLovinMAXMockPlugin;
 #endif
 
 // MARK: - Enums
 
+// NOTE: Values are sent to the Android plugin as integers, so the order must match the AD_VIEW_LAYOUTS table in MaxUnrealPlugin.java
 UENUM()
 enum class EAdViewPosition : uint8
 {
@@ -48,6 +62,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void Initialize(const FString &SdkKey);
 
+    /**
+     * Initialize the default instance of AppLovin SDK without blocking the calling thread on creating the native plugin.
+     * The plugin is created and initialized on a background task, or on the main thread on iOS. Calls made until then that do not
+     * return a value are queued and replayed in order on the game thread once the plugin is ready. Calls that return a value are answered right away,
+     * but wait for the plugin to be created if they need to ask it. Mock settings must be set before calling this.
+     * @param SdkKey - AppLovin SDK key
+     * @return Future that is set on the game thread once the plugin is initializing and the queued calls have been replayed, so do not wait on it
+     * from the game thread. Use OnSdkInitializedDelegate to know when the SDK is ready.
+     */
+    static TFuture<void> InitializeAsync(const FString &SdkKey);
+
     /**
      * Check if the SDK has been initialized.
      * @param SdkKey - AppLovin SDK key
@@ -219,6 +244,51 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void TrackEvent(const FString &Name, const TMap<FString, FString> &Parameters);
 
+    /**
+     * Buffer tracked events and send them to the native plugin in one call per frame instead of one call per event.
+     * Only has an effect on Android, where each call crosses JNI and is parsed again on the Java side.
+     * @param bEnabled - Whether tracked events are buffered. Disabling sends any buffered events right away.
+     * @param MaxBatchSize - Number of buffered events that are sent right away instead of waiting for the next frame
+     * @param MaxBatchDelay - Seconds to keep buffering events before sending them on the next frame. 0 sends them every frame.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (AdvancedDisplay = "MaxBatchSize,MaxBatchDelay"))
+    static void SetEventBatchingEnabled(bool bEnabled, int32 MaxBatchSize = 64, float MaxBatchDelay = 0.0f);
+
+    /**
+     * Send any buffered tracked events to the native plugin now.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void FlushTrackedEvents();
+
+    // MARK: - Ad Units
+
+    /**
+     * Register an ad unit and get a handle for it.
+     * The banner, MREC, interstitial and rewarded ad methods also accept the handle, which skips validating and looking up the identifier on every call.
+     * Events for the ad unit carry the same handle in FAdInfo::AdUnitHandle.
+     * @param AdUnitIdentifier - The ad unit identifier to register
+     * @return The handle of the ad unit. Registering the same identifier again returns the same handle.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static FAdUnitHandle RegisterAdUnit(const FString &AdUnitIdentifier);
+
+    // MARK: - Ad View Commands
+
+    /**
+     * Buffer banner and MREC operations and submit them to the native plugin in one call per frame instead of one call per operation.
+     * Operations on the same ad view are collapsed, e.g. only the last position update or the last show or hide is kept, so each ad view is laid out once per frame.
+     * Creating or destroying an ad view submits the buffered operations first. Only has an effect on Android.
+     * @param bEnabled - Whether ad view operations are buffered. Disabling submits any buffered operations right away.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void SetAdViewCommandBufferingEnabled(bool bEnabled);
+
+    /**
+     * Submit any buffered banner and MREC operations to the native plugin now.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void SubmitAdViewCommands();
+
     // MARK: - Banners
 
     /**
@@ -228,6 +298,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void CreateBanner(const FString &AdUnitIdentifier, EAdViewPosition BannerPosition);
+    static void CreateBanner(FAdUnitHandle AdUnit, EAdViewPosition BannerPosition);
 
     /**
      * Set non-transparent background color for banners to be fully functional.
@@ -268,6 +339,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void ShowBanner(const FString &AdUnitIdentifier);
+    static void ShowBanner(FAdUnitHandle AdUnit);
 
     /**
      * Hide banner.
@@ -275,6 +347,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void HideBanner(const FString &AdUnitIdentifier);
+    static void HideBanner(FAdUnitHandle AdUnit);
 
     /**
      * Remove banner from the ad view and destroy it.
@@ -282,6 +355,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void DestroyBanner(const FString &AdUnitIdentifier);
+    static void DestroyBanner(FAdUnitHandle AdUnit);
 
     // MARK: - MRECs
 
@@ -292,6 +366,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void CreateMRec(const FString &AdUnitIdentifier, EAdViewPosition MRecPosition);
+    static void CreateMRec(FAdUnitHandle AdUnit, EAdViewPosition MRecPosition);
 
     /**
      * Set the MREC placement for an ad unit identifier to tie the future ad events to.
@@ -324,6 +399,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void ShowMRec(const FString &AdUnitIdentifier);
+    static void ShowMRec(FAdUnitHandle AdUnit);
 
     /**
      * Hide MREC.
@@ -331,6 +407,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void HideMRec(const FString &AdUnitIdentifier);
+    static void HideMRec(FAdUnitHandle AdUnit);
 
     /**
      * Remove MREC from the ad view and destroy it.
@@ -338,6 +415,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void DestroyMRec(const FString &AdUnitIdentifier);
+    static void DestroyMRec(FAdUnitHandle AdUnit);
 
     // MARK: - Interstitials
 
@@ -347,13 +425,17 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void LoadInterstitial(const FString &AdUnitIdentifier);
+    static void LoadInterstitial(FAdUnitHandle AdUnit);
 
     /**
      * Check if the interstitial is loaded and ready to be displayed.
+     * Readiness is cached from the interstitial's ad events, so this is cheap enough to call every frame.
      * @param AdUnitIdentifier - The ad unit identifier of the interstitial to check if ready to be displayed
+     * @param bVerifyWithNative - If true, ask the native SDK instead of using the cached readiness
      */
-    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
-    static bool IsInterstitialReady(const FString &AdUnitIdentifier);
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (AdvancedDisplay = "bVerifyWithNative"))
+    static bool IsInterstitialReady(const FString &AdUnitIdentifier, bool bVerifyWithNative = false);
+    static bool IsInterstitialReady(FAdUnitHandle AdUnit, bool bVerifyWithNative = false);
 
     /**
      * Present loaded interstitial. If the interstitial is not ready to be displayed nothing will happen.
@@ -368,6 +450,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void ShowInterstitial(const FString &AdUnitIdentifier, const FString &Placement);
+    static void ShowInterstitial(FAdUnitHandle AdUnit, const FString &Placement = FString());
 
     /**
      * Set an extra parameter for the interstitial.
@@ -378,6 +461,29 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void SetInterstitialExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value);
 
+    /**
+     * Destroy the interstitial, releasing a loaded ad and the memory it holds. The interstitial must be loaded again before it can be shown.
+     * Has an effect on Android, iOS and the desktop mock.
+     * @param AdUnitIdentifier - The ad unit identifier of the interstitial to destroy
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void DestroyInterstitial(const FString &AdUnitIdentifier);
+
+    /**
+     * Start loading an interstitial and get its result without binding to the static delegates.
+     * @param AdUnit - The handle of the interstitial to load
+     * @return Future set to the FAdInfo of the loaded ad or the FAdError of the failed load, on the thread the event arrives on.
+     */
+    static TFuture<FAdResult> LoadInterstitialAsync(FAdUnitHandle AdUnit);
+
+    /**
+     * Present loaded interstitial and get the result of showing it without binding to the static delegates.
+     * @param AdUnit - The handle of the interstitial to show
+     * @param Placement - The placement to tie the showing ad events to
+     * @return Future set to the FAdInfo of the hidden ad or the FAdError of the failed display, on the thread the event arrives on.
+     */
+    static TFuture<FAdResult> ShowInterstitialAsync(FAdUnitHandle AdUnit, const FString &Placement = FString());
+
     // MARK: - Rewarded
 
     /**
@@ -386,13 +492,17 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void LoadRewardedAd(const FString &AdUnitIdentifier);
+    static void LoadRewardedAd(FAdUnitHandle AdUnit);
 
     /**
      * Check if the rewarded ad is loaded and ready to be displayed.
+     * Readiness is cached from the rewarded ad's events, so this is cheap enough to call every frame.
      * @param AdUnitIdentifier - The ad unit identifier of the rewarded to check if ready to be displayed
+     * @param bVerifyWithNative - If true, ask the native SDK instead of using the cached readiness
      */
-    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
-    static bool IsRewardedAdReady(const FString &AdUnitIdentifier);
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (AdvancedDisplay = "bVerifyWithNative"))
+    static bool IsRewardedAdReady(const FString &AdUnitIdentifier, bool bVerifyWithNative = false);
+    static bool IsRewardedAdReady(FAdUnitHandle AdUnit, bool bVerifyWithNative = false);
 
     /**
      * Present loaded rewarded ad. If the rewarded ad is not ready to be displayed nothing will happen.
@@ -407,6 +517,7 @@ public:
      */
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void ShowRewardedAd(const FString &AdUnitIdentifier, const FString &Placement);
+    static void ShowRewardedAd(FAdUnitHandle AdUnit, const FString &Placement = FString());
 
     /**
      * Set an extra parameter for the rewarded ad.
@@ -417,6 +528,148 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
     static void SetRewardedAdExtraParameter(const FString &AdUnitIdentifier, const FString &Key, const FString &Value);
 
+    /**
+     * Destroy the rewarded ad, releasing a loaded ad and the memory it holds. The rewarded ad must be loaded again before it can be shown.
+     * Has an effect on Android and the desktop mock. Does nothing on iOS, where the SDK owns rewarded ads and keeps a loaded one until it is shown.
+     * @param AdUnitIdentifier - The ad unit identifier of the rewarded ad to destroy
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void DestroyRewardedAd(const FString &AdUnitIdentifier);
+
+    /**
+     * Start loading a rewarded ad and get its result without binding to the static delegates.
+     * @param AdUnit - The handle of the rewarded ad to load
+     * @return Future set to the FAdInfo of the loaded ad or the FAdError of the failed load, on the thread the event arrives on.
+     */
+    static TFuture<FAdResult> LoadRewardedAdAsync(FAdUnitHandle AdUnit);
+
+    /**
+     * Present loaded rewarded ad and get the result of showing it without binding to the static delegates.
+     * @param AdUnit - The handle of the rewarded ad to show
+     * @param Placement - The placement to tie the showing ad events to
+     * @return Future set to the FAdInfo of the hidden ad, with the reward the user earned if any, or to the FAdError of the failed display,
+     * on the thread the event arrives on.
+     */
+    static TFuture<FRewardedAdResult> ShowRewardedAdAsync(FAdUnitHandle AdUnit, const FString &Placement = FString());
+
+    // MARK: - Ad Inventory
+
+    /**
+     * Free memory held by ads when the device runs low on memory, by destroying hidden banners and MRECs and loaded interstitial and rewarded ads.
+     * Evictions start on engine memory warnings and, on Android, the system trim memory callback, and go from hidden MRECs to hidden banners,
+     * interstitials and rewarded ads. Visible ad views are never evicted. Once no memory warning has arrived for RestoreDelay seconds,
+     * evicted ad views are re-created and evicted ads reloaded. Showing an evicted banner or MREC re-creates it right away.
+     * Enable this before creating ad views, since they are re-created from the calls made while it is enabled.
+     * @param bEnabled - Whether to evict under memory pressure. Disabling restores everything still evicted.
+     * @param bEvictLoadedAds - Whether loaded interstitial and rewarded ads may be evicted, or only hidden ad views. Rewarded ads are never evicted on iOS,
+     *                          where the SDK keeps them loaded.
+     * @param RestoreDelay - Seconds without a memory warning before evicted ads are restored
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (AdvancedDisplay = "bEvictLoadedAds,RestoreDelay"))
+    static void SetAdInventoryManagementEnabled(bool bEnabled, bool bEvictLoadedAds = true, float RestoreDelay = 30.0f);
+
+    /**
+     * Evict ads as if a memory warning was received, e.g. before loading a large level. Has no effect unless inventory management is enabled.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void EvictAdInventory();
+
+    /**
+     * Get the evictions made since inventory management was enabled, oldest first, with the memory each one freed.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static TArray<FAdInventoryEviction> GetAdInventoryEvictions();
+
+    // MARK: - Fullscreen Ad Throttling
+
+    /**
+     * Throttle the engine while an interstitial or rewarded ad is displayed, to free CPU and GPU time for the ad and keep the device cool.
+     * The engine is throttled on the game thread when the ad is displayed, and restored when it is hidden or fails to display.
+     * @param bEnabled - Whether to throttle. Disabling while an ad is displayed restores the engine right away.
+     * @param Settings - What to pause, cap or suspend. Changes take effect from the next displayed ad.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (AutoCreateRefTerm = "Settings"))
+    static void SetFullscreenAdThrottlingEnabled(bool bEnabled, const FAppLovinMAXThrottleSettings &Settings);
+
+    /**
+     * Check if the engine is currently throttled for a displayed interstitial or rewarded ad.
+     */
+    UFUNCTION(BlueprintPure, Category = "AppLovinMAX")
+    static bool IsFullscreenAdThrottling();
+
+    // MARK: - Revenue
+
+    /**
+     * Get the revenue paid so far for each ad unit, aggregated from the revenue paid events of all ad formats.
+     * Summaries are sorted by revenue, highest first. Safe to call from any thread.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static TArray<FAdRevenueSummary> GetRevenueByAdUnit();
+
+    /**
+     * Get the revenue paid so far for each network, aggregated from the revenue paid events of all ad formats.
+     * Summaries are sorted by revenue, highest first. Safe to call from any thread.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static TArray<FAdRevenueSummary> GetRevenueByNetwork();
+
+    /**
+     * Get the revenue paid so far for each placement, aggregated from the revenue paid events of all ad formats.
+     * Ads shown without a placement are grouped under an empty key. Summaries are sorted by revenue, highest first. Safe to call from any thread.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static TArray<FAdRevenueSummary> GetRevenueByPlacement();
+
+    /**
+     * Reset the aggregated revenue, e.g. at the start of a session or after the totals have been reported.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void ResetRevenue();
+
+    // MARK: - Ad Errors
+
+    /**
+     * Get the waterfall of network responses behind a failed ad load, e.g. to analyze network latency on failed loads.
+     * The waterfall is only parsed when it is first read, so ad errors that are never inspected do not pay for it.
+     * @param AdError - The error received by a load failed delegate
+     */
+    UFUNCTION(BlueprintPure, Category = "AppLovinMAX")
+    static FAdWaterfallInfo GetAdErrorWaterfall(const FAdError &AdError);
+
+    /**
+     * Get a readable description of the waterfall behind a failed ad load, e.g. for logging. Replaces the deprecated FAdError::Waterfall property.
+     * @param AdError - The error received by a load failed delegate
+     */
+    UFUNCTION(BlueprintPure, Category = "AppLovinMAX")
+    static FString GetAdErrorWaterfallString(const FAdError &AdError);
+
+    // MARK: - Event Recording
+
+    /**
+     * Record the events received from the native plugin to a binary log, e.g. to reproduce the event load of a device session
+     * on a desktop build with AppLovinMAX.ReplayEvents. Events are written out by a background thread.
+     * @param FilePath - Path of the log file. Relative paths are resolved against Saved/AppLovinMAX.
+     * @return False if the file could not be created
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static bool StartEventRecording(const FString &FilePath);
+
+    /**
+     * Stop recording events and finish writing the log.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void StopEventRecording();
+
+    // MARK: - Mock Backend
+
+    /**
+     * Configure the simulated ad backend used on platforms without the native AppLovin SDK, e.g. Linux build agents.
+     * When enabled, initialization, ad loads, shows and ad view refreshes produce simulated events through the regular delegates. Has no effect on iOS and Android.
+     * @param Settings - Latency, fill rate, revenue and seed for the simulated events
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX")
+    static void SetMockSettings(const FAppLovinMAXMockSettings &Settings);
+
     // MARK: - Delegates
 
     DECLARE_MULTICAST_DELEGATE_OneParam(FOnSdkInitializedDelegate, const FSdkConfiguration & /*SdkConfiguration*/);
@@ -489,19 +742,69 @@ public:
     static FOnRewardedAdRevenuePaidDelegate OnRewardedAdRevenuePaidDelegate;
     static FOnRewardedAdReceivedRewardDelegate OnRewardedAdReceivedRewardDelegate;
 
+    // MARK: - Delegate Threads
+
+    /** Threads that the static delegates above can be broadcast on. The events of UAppLovinMAXDelegate components are always broadcast on the game thread. */
+    enum class EDelegateThread : uint8
+    {
+        /** Immediately on the thread that delivered the event: the JNI thread on Android or the main thread on iOS. Lowest latency, and the default. */
+        AnyThread,
+        /** On the game thread. Events that arrive before the game thread gets to them are broadcast together. */
+        GameThread,
+        /** On the task graph thread passed as NamedThread, e.g. ENamedThreads::AnyBackgroundThreadNormalTask. */
+        NamedThread
+    };
+
+    /**
+     * Sets the thread that the static delegate for an event is broadcast on.
+     * Events sent to the same thread are broadcast in the order the native plugin sent them. Events sent to different threads are not ordered
+     * relative to each other, so to receive all events of an ad unit in order, broadcast the delegates of its format on the same thread.
+     * Set this before the event is expected: events already waiting for a thread are still broadcast there.
+     * @param Event - Event whose delegate to move, e.g. EAppLovinMAXEvent::InterstitialAdLoaded for OnInterstitialAdLoadedDelegate
+     * @param Thread - Thread to broadcast on
+     * @param NamedThread - Task graph thread to broadcast on when Thread is EDelegateThread::NamedThread
+     */
+    static void SetDelegateThread(EAppLovinMAXEvent Event, EDelegateThread Thread, ENamedThreads::Type NamedThread = ENamedThreads::GameThread);
+
+    /** Sets the thread that the static delegates for all events are broadcast on. */
+    static void SetAllDelegateThreads(EDelegateThread Thread, ENamedThreads::Type NamedThread = ENamedThreads::GameThread);
+
 protected:
+    // MARK: - Ad Unit Calls
+
+    // Shared by the identifier and handle overloads above. AdUnit is invalid once more than FAdUnitHandle::MaxAdUnits ad units are in use,
+    // in which case the call goes to the native plugin by identifier alone and readiness is always checked with the native plugin.
+    static void CreateBanner(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, EAdViewPosition BannerPosition);
+    static void ShowBanner(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
+    static void HideBanner(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
+    static void DestroyBanner(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
+    static void CreateMRec(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, EAdViewPosition MRecPosition);
+    static void ShowMRec(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
+    static void HideMRec(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
+    static void DestroyMRec(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
+    static void LoadInterstitial(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
+    static bool IsInterstitialReady(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, bool bVerifyWithNative);
+    static void ShowInterstitial(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, const FString &Placement);
+    static void LoadRewardedAd(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
+    static bool IsRewardedAdReady(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, bool bVerifyWithNative);
+    static void ShowRewardedAd(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier, const FString &Placement);
+
     // MARK: - Utility Methods
 
-    static FString GetAdViewPositionString(EAdViewPosition AdViewPosition);
-    static FString GetUserGeographyString(EConsentFlowUserGeography UserGeography);
+    static const TCHAR *GetUserGeographyString(EConsentFlowUserGeography UserGeography);
     static void ValidateAdUnitIdentifier(const FString &AdUnitIdentifier, const FString &DebugPurpose);
+    static const FString *ResolveAdUnitHandle(FAdUnitHandle AdUnit, const TCHAR *DebugPurpose);
+    static void RegisterNativeAdUnitHandle(FAdUnitHandle AdUnit, const FString &AdUnitIdentifier);
 
 #if PLATFORM_IOS
-    static NSString *GetNSString(const FString &String);
     static NSArray<NSString *> *GetNSArray(const TArray<FString> &Array);
     static NSDictionary<NSString *, NSString *> *GetNSDictionary(const TMap<FString, FString> &Map);
     static MAUnrealPlugin *GetIOSPlugin();
 #elif PLATFORM_ANDROID
     static TSharedPtr<FJavaAndroidMaxUnrealPlugin> GetAndroidPlugin();
+    static FAppLovinMAXEventBatch &GetEventBatch();
+    static FAppLovinMAXAdViewCommandBuffer &GetAdViewCommandBuffer();
+#else
+    static TSharedPtr<FAppLovinMAXMockPlugin> GetMockPlugin();
 #endif
 };
@@ -0,0 +1,166 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdError.h"
+#include "AdInfo.h"
+#include "AdReward.h"
+#include "AdUnitHandle.h"
+#include "AppLovinMAXEvent.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "AppLovinMAXAsyncActions.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAdActionDynamicDelegate, const FAdInfo &, AdInfo, const FAdError &, AdError);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnRewardedAdActionDynamicDelegate, const FAdInfo &, AdInfo, const FAdError &, AdError, const FAdReward &, Reward);
+
+/**
+ * Base for the latent Blueprint nodes that make a load or show call and fire an exec pin for each ad event of the ad unit that follows,
+ * instead of polling readiness on tick. Events are routed to the node by ad unit and its pins fire on the game thread.
+ */
+UCLASS(Abstract)
+class APPLOVINMAX_API UAppLovinMAXAdAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Activate() override;
+    virtual void BeginDestroy() override;
+
+protected:
+    /** Makes the load or show call. Called once the node listens to the ad unit, so that none of the resulting events is missed. */
+    virtual void StartAdCall(FAdUnitHandle AdUnit) PURE_VIRTUAL(UAppLovinMAXAdAction::StartAdCall, );
+
+    /** Returns true for the events the node has a pin for. Called once on activation. */
+    virtual bool IsHandledEvent(EAppLovinMAXEvent Event) const PURE_VIRTUAL(UAppLovinMAXAdAction::IsHandledEvent, return false;);
+
+    /** Fires the pin for a handled event on the game thread. Returns true once the node is done. */
+    virtual bool HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward) PURE_VIRTUAL(UAppLovinMAXAdAction::HandleAdEvent, return true;);
+
+    /** Returns the failure event that is fired with an error when the ad unit identifier is invalid. */
+    virtual EAppLovinMAXEvent GetFailureEvent() const PURE_VIRTUAL(UAppLovinMAXAdAction::GetFailureEvent, return EAppLovinMAXEvent::Unknown;);
+
+    FString AdUnitIdentifier;
+
+private:
+    void Finish();
+
+    FAdUnitHandle ListenedAdUnit;
+    uint32 ListenerId = 0;
+    bool bIsFinished = false;
+};
+
+UCLASS()
+class APPLOVINMAX_API UAppLovinMAXLoadAdAction : public UAppLovinMAXAdAction
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Start loading an interstitial and wait for the result.
+     * @param AdUnitIdentifier - The ad unit identifier of the interstitial to load
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Load Interstitial And Wait"))
+    static UAppLovinMAXLoadAdAction *LoadInterstitialAndWait(UObject *WorldContextObject, const FString &AdUnitIdentifier);
+
+    /**
+     * Start loading a rewarded ad and wait for the result.
+     * @param AdUnitIdentifier - The ad unit identifier of the rewarded ad to load
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Load Rewarded Ad And Wait"))
+    static UAppLovinMAXLoadAdAction *LoadRewardedAdAndWait(UObject *WorldContextObject, const FString &AdUnitIdentifier);
+
+    /** Fired when the ad is loaded and ready to be displayed. */
+    UPROPERTY(BlueprintAssignable)
+    FOnAdActionDynamicDelegate Loaded;
+
+    /** Fired when the ad failed to load. */
+    UPROPERTY(BlueprintAssignable)
+    FOnAdActionDynamicDelegate Failed;
+
+protected:
+    virtual void StartAdCall(FAdUnitHandle AdUnit) override;
+    virtual bool IsHandledEvent(EAppLovinMAXEvent Event) const override;
+    virtual bool HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward) override;
+    virtual EAppLovinMAXEvent GetFailureEvent() const override;
+
+private:
+    bool bIsRewarded = false;
+};
+
+UCLASS()
+class APPLOVINMAX_API UAppLovinMAXShowInterstitialAction : public UAppLovinMAXAdAction
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Present loaded interstitial and wait until it is hidden.
+     * @param AdUnitIdentifier - The ad unit identifier of the interstitial to show
+     * @param Placement - The placement to tie the showing ad events to
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Show Interstitial And Wait"))
+    static UAppLovinMAXShowInterstitialAction *ShowInterstitialAndWait(UObject *WorldContextObject, const FString &AdUnitIdentifier, const FString &Placement);
+
+    /** Fired when the interstitial is displayed. */
+    UPROPERTY(BlueprintAssignable)
+    FOnAdActionDynamicDelegate Displayed;
+
+    /** Fired when the interstitial is hidden. */
+    UPROPERTY(BlueprintAssignable)
+    FOnAdActionDynamicDelegate Hidden;
+
+    /** Fired when the interstitial failed to display, e.g. because it was not ready. */
+    UPROPERTY(BlueprintAssignable)
+    FOnAdActionDynamicDelegate Failed;
+
+protected:
+    virtual void StartAdCall(FAdUnitHandle AdUnit) override;
+    virtual bool IsHandledEvent(EAppLovinMAXEvent Event) const override;
+    virtual bool HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward) override;
+    virtual EAppLovinMAXEvent GetFailureEvent() const override;
+
+private:
+    FString Placement;
+};
+
+UCLASS()
+class APPLOVINMAX_API UAppLovinMAXShowRewardedAdAction : public UAppLovinMAXAdAction
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Present loaded rewarded ad and wait for the reward and for the ad to be hidden.
+     * @param AdUnitIdentifier - The ad unit identifier of the rewarded ad to show
+     * @param Placement - The placement to tie the showing ad events to
+     */
+    UFUNCTION(BlueprintCallable, Category = "AppLovinMAX", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Show Rewarded And Await Reward"))
+    static UAppLovinMAXShowRewardedAdAction *ShowRewardedAdAndAwaitReward(UObject *WorldContextObject, const FString &AdUnitIdentifier, const FString &Placement);
+
+    /** Fired when the rewarded ad is displayed. */
+    UPROPERTY(BlueprintAssignable)
+    FOnRewardedAdActionDynamicDelegate Displayed;
+
+    /** Fired when the user has earned the reward. The ad may still be displayed. */
+    UPROPERTY(BlueprintAssignable)
+    FOnRewardedAdActionDynamicDelegate Rewarded;
+
+    /** Fired when the rewarded ad is hidden, with the reward if one was earned. */
+    UPROPERTY(BlueprintAssignable)
+    FOnRewardedAdActionDynamicDelegate Hidden;
+
+    /** Fired when the rewarded ad failed to display, e.g. because it was not ready. */
+    UPROPERTY(BlueprintAssignable)
+    FOnRewardedAdActionDynamicDelegate Failed;
+
+protected:
+    virtual void StartAdCall(FAdUnitHandle AdUnit) override;
+    virtual bool IsHandledEvent(EAppLovinMAXEvent Event) const override;
+    virtual bool HandleAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError, const FAdReward &Reward) override;
+    virtual EAppLovinMAXEvent GetFailureEvent() const override;
+
+private:
+    FString Placement;
+    FAdReward EarnedReward;
+};
@@ -6,6 +6,7 @@
 #include "AdError.h"
 #include "AdInfo.h"
 #include "AdReward.h"
+#include "AppLovinMAXEvent.h"
 #include "CmpError.h"
 #include "Components/ActorComponent.h"
 #include "SdkConfiguration.h"
@@ -59,9 +60,35 @@ public:
     
     static void BroadcastSdkInitializedEvent(const FSdkConfiguration &SdkConfiguration);
     static void BroadcastCmpCompletedEvent(const FCmpError &CmpError);
+    static void BroadcastAdEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo);
+    static void BroadcastAdErrorEvent(EAppLovinMAXEvent Event, const FAdInfo &AdInfo, const FAdError &AdError);
+    static void BroadcastRewardedAdReceivedRewardEvent(const FAdInfo &AdInfo, const FAdReward &Reward);
+
+    // Overloads taking the event name sent by the native plugins, kept for existing callers. Prefer the EAppLovinMAXEvent overloads, which skip the name lookup.
     static void BroadcastAdEvent(const FString &Name, const FAdInfo &AdInfo);
     static void BroadcastAdErrorEvent(const FString &Name, const FAdInfo &AdInfo, const FAdError &AdError);
-    static void BroadcastRewardedAdReceivedRewardEvent(const FAdInfo &AdInfo, const FAdReward &Reward);
+
+    // MARK: - Event Queue Counters
+
+    /** Returns the number of events waiting to be broadcast on the game thread. */
+    static int32 GetQueuedEventCount();
+
+    /** Returns how long in seconds the oldest event has been waiting to be broadcast, or 0 if none are waiting. Must be called on the game thread. */
+    static double GetOldestQueuedEventAge();
+
+    /** Returns the number of game thread tasks scheduled to broadcast queued events. */
+    static int32 GetPendingTaskCount();
+
+    /** Returns the number of delegate components that have begun play and will receive events. Must be called on the game thread. */
+    static int32 GetRegisteredDelegateCount();
+
+    // MARK: - UActorComponent
+
+    /** Registers this component to receive broadcasts. Only components in game or PIE worlds are registered. */
+    virtual void BeginPlay() override;
+
+    /** Unregisters this component so that broadcasts no longer reach it. */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // MARK: - Initialization
 
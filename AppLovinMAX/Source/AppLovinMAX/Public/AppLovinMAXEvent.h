@@ -0,0 +1,61 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Compact identifiers for the events forwarded from the native iOS and Android plugins.
+ * Event names are resolved to an identifier once when received so that dispatch never compares strings.
+ */
+enum class EAppLovinMAXEvent : uint8
+{
+    SdkInitialized,
+    CmpCompleted,
+
+    BannerAdLoaded,
+    BannerAdLoadFailed,
+    BannerAdClicked,
+    BannerAdExpanded,
+    BannerAdCollapsed,
+    BannerAdRevenuePaid,
+
+    MRecAdLoaded,
+    MRecAdLoadFailed,
+    MRecAdClicked,
+    MRecAdExpanded,
+    MRecAdCollapsed,
+    MRecAdRevenuePaid,
+
+    InterstitialAdLoaded,
+    InterstitialAdLoadFailed,
+    InterstitialAdDisplayed,
+    InterstitialAdDisplayFailed,
+    InterstitialAdHidden,
+    InterstitialAdClicked,
+    InterstitialAdRevenuePaid,
+
+    RewardedAdLoaded,
+    RewardedAdLoadFailed,
+    RewardedAdDisplayed,
+    RewardedAdDisplayFailed,
+    RewardedAdHidden,
+    RewardedAdClicked,
+    RewardedAdRevenuePaid,
+    RewardedAdReceivedReward,
+
+    Count,
+    Unknown = Count
+};
+
+namespace AppLovinMAXEvent
+{
+    /** Returns the identifier for an event name sent by the native plugins, or EAppLovinMAXEvent::Unknown. */
+    APPLOVINMAX_API EAppLovinMAXEvent FromName(const FString &Name);
+
+    /** Returns the event name sent by the native plugins for the given identifier. */
+    APPLOVINMAX_API const TCHAR *ToName(EAppLovinMAXEvent Event);
+
+    /** Returns true if the event body carries an FAdError in addition to the FAdInfo. */
+    APPLOVINMAX_API bool IsAdErrorEvent(EAppLovinMAXEvent Event);
+} // namespace AppLovinMAXEvent
@@ -0,0 +1,66 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AppLovinMAXMockSettings.generated.h"
+
+/**
+ * Settings for the simulated ad backend used on platforms without the native AppLovin SDK, e.g. Linux and Mac builds.
+ * The simulated backend produces SDK and ad events through the same event path as the native plugins, so game code,
+ * delegates and the event pipeline can be exercised and profiled without a device or network.
+ * Events are deterministic for a given seed, sequence of calls and frame timing.
+ */
+USTRUCT(BlueprintType)
+struct APPLOVINMAX_API FAppLovinMAXMockSettings
+{
+    GENERATED_BODY()
+
+    /** Whether UAppLovinMAX calls are handled by the simulated backend. When disabled, calls do nothing as before. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    bool bEnabled = false;
+
+    /** Seed for fill and revenue decisions. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    int32 Seed = 0;
+
+    /** Fraction of ad loads that succeed. The rest fail with a no fill error. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX", meta = (ClampMin = "0", ClampMax = "1"))
+    float FillRate = 0.9f;
+
+    /** Minimum time in seconds between a load or initialize call and its result event. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX", meta = (ClampMin = "0"))
+    float LoadLatency = 0.5f;
+
+    /** Random extra time in seconds added to LoadLatency for each load. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX", meta = (ClampMin = "0"))
+    float LoadLatencyJitter = 0.5f;
+
+    /** Time in seconds that a shown interstitial or rewarded ad stays on screen before it is hidden. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX", meta = (ClampMin = "0"))
+    float DisplayDuration = 5.0f;
+
+    /** Time in seconds between banner and MREC refreshes. Set to 0 to disable refreshes. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX", meta = (ClampMin = "0"))
+    float AdViewRefreshInterval = 30.0f;
+
+    /** Average revenue in USD paid for each impression. Each impression pays between half and one and a half times this. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX", meta = (ClampMin = "0"))
+    double RevenuePerImpression = 0.01;
+
+    /** Network name reported for every ad. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    FString NetworkName = TEXT("AppLovin");
+
+    /** Reward label reported for rewarded ads. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    FString RewardLabel = TEXT("coins");
+
+    /** Reward amount reported for rewarded ads. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    int32 RewardAmount = 10;
+
+    /** Country code reported in the SDK configuration. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    FString CountryCode = TEXT("US");
+};
@@ -0,0 +1,43 @@
+// Copyright AppLovin Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AppLovinMAXThrottleSettings.generated.h"
+
+/**
+ * What the engine gives up while an interstitial or rewarded ad covers the game, so that the ad, and especially video ads,
+ * get the CPU, GPU and thermal headroom instead. Everything is restored when the ad is hidden or fails to display.
+ */
+USTRUCT(BlueprintType)
+struct APPLOVINMAX_API FAppLovinMAXThrottleSettings
+{
+    GENERATED_BODY()
+
+    /** Whether to pause the game world. Games whose game mode disallows pausing are only throttled by the other settings. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    bool bPauseWorld = true;
+
+    /** Frame rate cap while the ad is displayed. Set to 0 to keep the current frame rate. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX", meta = (ClampMin = "0"))
+    float ThrottledMaxFPS = 10.0f;
+
+    /** Whether to stop rendering the world in the game viewport. UI is still drawn. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    bool bSuspendRendering = true;
+
+    /** Whether to suspend the main audio device, so that game audio neither plays over the ad nor costs mixing time. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    bool bSuspendAudio = true;
+
+    /** Whether to free pooled render targets that are not in use. They are recreated on demand, which costs some time after the ad. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX")
+    bool bReleaseRenderTargets = false;
+
+    /**
+     * Frames to render with the world still paused after the ad, so that render targets, shaders and audio are warmed up
+     * before gameplay resumes. Only used with bPauseWorld.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AppLovinMAX", meta = (ClampMin = "0"))
+    int32 PrewarmFrames = 2;
+};
@@ -53,23 +53,27 @@ typedef void(*UnrealEventCallback)(NSString *name, NSString *body);
 
 - (void)trackEvent:(NSString *)event parameters:(NSDictionary<NSString *, NSString *> *)parameters;
 
+#pragma mark - Ad Units
+
+- (void)setAdUnitHandle:(int)adUnitHandle forAdUnitIdentifier:(NSString *)adUnitIdentifier;
+
 #pragma mark - Banners
 
-- (void)createBannerWithAdUnitIdentifier:(NSString *)adUnitIdentifier atPosition:(NSString *)bannerPosition;
+- (void)createBannerWithAdUnitIdentifier:(NSString *)adUnitIdentifier atPosition:(int)bannerPosition;
 - (void)setBannerBackgroundColorForAdUnitIdentifier:(NSString *)adUnitIdentifier hexColorCode:(NSString *)hexColorCode;
 - (void)setBannerPlacement:(nullable NSString *)placement forAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)setBannerExtraParameterForAdUnitIdentifier:(NSString *)adUnitIdentifier key:(NSString *)key value:(nullable NSString *)value;
-- (void)updateBannerPosition:(NSString *)bannerPosition forAdUnitIdentifier:(NSString *)adUnitIdentifier;
+- (void)updateBannerPosition:(int)bannerPosition forAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)showBannerWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)hideBannerWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)destroyBannerWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
 
 #pragma mark - MRECs
 
-- (void)createMRecWithAdUnitIdentifier:(NSString *)adUnitIdentifier atPosition:(NSString *)mrecPosition;
+- (void)createMRecWithAdUnitIdentifier:(NSString *)adUnitIdentifier atPosition:(int)mrecPosition;
 - (void)setMRecPlacement:(nullable NSString *)placement forAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)setMRecExtraParameterForAdUnitIdentifier:(NSString *)adUnitIdentifier key:(NSString *)key value:(nullable NSString *)value;
-- (void)updateMRecPosition:(NSString *)mrecPosition forAdUnitIdentifier:(NSString *)adUnitIdentifier;
+- (void)updateMRecPosition:(int)mrecPosition forAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)showMRecWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)hideMRecWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)destroyMRecWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
@@ -80,6 +84,7 @@ typedef void(*UnrealEventCallback)(NSString *name, NSString *body);
 - (BOOL)isInterstitialReadyWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
 - (void)showInterstitialWithAdUnitIdentifier:(NSString *)adUnitIdentifier placement:(NSString *)placement;
 - (void)setInterstitialExtraParameterForAdUnitIdentifier:(NSString *)adUnitIdentifier key:(NSString *)key value:(NSString *)value;
+- (void)destroyInterstitialWithAdUnitIdentifier:(NSString *)adUnitIdentifier;
 
 #pragma mark - Rewarded
 
@@ -28,6 +28,15 @@
 @property (nonatomic, assign, readonly, getter=al_isValidString) BOOL al_validString;
 @end
 
+// NOTE: Must match the order of EAdViewPosition in AppLovinMAX.h
+static NSString *const ALAdViewPositions[] = {@"top_left", @"top_center", @"top_right",
+                                              @"centered", @"center_left", @"center_right",
+                                              @"bottom_left", @"bottom_center", @"bottom_right"};
+static const int ALAdViewPositionCount = sizeof(ALAdViewPositions) / sizeof(ALAdViewPositions[0]);
+
+// Version of the compact waterfall encoding sent with ad errors, see waterfallDataForError:
+static const int ALWaterfallDataVersion = 1;
+
 @interface MAUnrealPlugin()<MAAdRevenueDelegate, MAAdDelegate, MAAdViewAdDelegate, MARewardedAdDelegate>
 
 // Parent Fields
@@ -52,6 +61,9 @@
 @property (nonatomic, strong) NSMutableDictionary<NSString *, MAInterstitialAd *> *interstitials;
 @property (nonatomic, strong) NSMutableDictionary<NSString *, MARewardedAd *> *rewardedAds;
 
+// Ad Unit Fields
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *adUnitHandles;
+
 // Banner Fields
 @property (nonatomic, strong) NSMutableDictionary<NSString *, MAAdView *> *adViews;
 @property (nonatomic, strong) NSMutableDictionary<NSString *, MAAdFormat *> *adViewAdFormats;
@@ -80,6 +92,7 @@ static NSString *const TAG = @"MAUnrealPlugin";
     {
         self.interstitials = [NSMutableDictionary dictionaryWithCapacity: 2];
         self.rewardedAds = [NSMutableDictionary dictionaryWithCapacity: 2];
+        self.adUnitHandles = [NSMutableDictionary dictionaryWithCapacity: 4];
         self.adViews = [NSMutableDictionary dictionaryWithCapacity: 2];
         self.adViewAdFormats = [NSMutableDictionary dictionaryWithCapacity: 2];
         self.verticalAdViewFormats = [NSMutableDictionary dictionaryWithCapacity: 2];
@@ -443,11 +456,22 @@ static NSString *const TAG = @"MAUnrealPlugin";
     [self.sdk.eventService trackEvent: event parameters: parameters];
 }
 
+#pragma mark - Ad Units
+
+// Called by Unreal before the first ad of the ad unit is created, so that the ad unit's events carry its handle and Unreal does not need to look up the identifier
+- (void)setAdUnitHandle:(int)adUnitHandle forAdUnitIdentifier:(NSString *)adUnitIdentifier
+{
+    @synchronized ( self.adUnitHandles )
+    {
+        self.adUnitHandles[adUnitIdentifier] = @(adUnitHandle);
+    }
+}
+
 #pragma mark - Banners
 
-- (void)createBannerWithAdUnitIdentifier:(NSString *)adUnitIdentifier atPosition:(NSString *)bannerPosition
+- (void)createBannerWithAdUnitIdentifier:(NSString *)adUnitIdentifier atPosition:(int)bannerPosition
 {
-    [self createAdViewWithAdUnitIdentifier: adUnitIdentifier adFormat: DEVICE_SPECIFIC_ADVIEW_AD_FORMAT atPosition: bannerPosition];
+    [self createAdViewWithAdUnitIdentifier: adUnitIdentifier adFormat: DEVICE_SPECIFIC_ADVIEW_AD_FORMAT atPosition: [self adViewPositionForIndex: bannerPosition]];
 }
 
 - (void)setBannerBackgroundColorForAdUnitIdentifier:(NSString *)adUnitIdentifier hexColorCode:(NSString *)hexColorCode
@@ -465,9 +489,9 @@ static NSString *const TAG = @"MAUnrealPlugin";
     [self setAdViewExtraParameterForAdUnitIdentifier: adUnitIdentifier adFormat: DEVICE_SPECIFIC_ADVIEW_AD_FORMAT key: key value: value];
 }
 
-- (void)updateBannerPosition:(NSString *)bannerPosition forAdUnitIdentifier:(NSString *)adUnitIdentifier
+- (void)updateBannerPosition:(int)bannerPosition forAdUnitIdentifier:(NSString *)adUnitIdentifier
 {
-    [self updateAdViewPosition: bannerPosition forAdUnitIdentifier: adUnitIdentifier adFormat: DEVICE_SPECIFIC_ADVIEW_AD_FORMAT];
+    [self updateAdViewPosition: [self adViewPositionForIndex: bannerPosition] forAdUnitIdentifier: adUnitIdentifier adFormat: DEVICE_SPECIFIC_ADVIEW_AD_FORMAT];
 }
 
 - (void)showBannerWithAdUnitIdentifier:(NSString *)adUnitIdentifier
@@ -487,9 +511,9 @@ static NSString *const TAG = @"MAUnrealPlugin";
 
 #pragma mark - MRECs
 
-- (void)createMRecWithAdUnitIdentifier:(NSString *)adUnitIdentifier atPosition:(NSString *)mrecPosition
+- (void)createMRecWithAdUnitIdentifier:(NSString *)adUnitIdentifier atPosition:(int)mrecPosition
 {
-    [self createAdViewWithAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec atPosition: mrecPosition];
+    [self createAdViewWithAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec atPosition: [self adViewPositionForIndex: mrecPosition]];
 }
 
 - (void)setMRecPlacement:(nullable NSString *)placement forAdUnitIdentifier:(NSString *)adUnitIdentifier
@@ -502,9 +526,9 @@ static NSString *const TAG = @"MAUnrealPlugin";
     [self setAdViewExtraParameterForAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec key: key value: value];
 }
 
-- (void)updateMRecPosition:(NSString *)mrecPosition forAdUnitIdentifier:(NSString *)adUnitIdentifier
+- (void)updateMRecPosition:(int)mrecPosition forAdUnitIdentifier:(NSString *)adUnitIdentifier
 {
-    [self updateAdViewPosition: mrecPosition forAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec];
+    [self updateAdViewPosition: [self adViewPositionForIndex: mrecPosition] forAdUnitIdentifier: adUnitIdentifier adFormat: MAAdFormat.mrec];
 }
 
 - (void)showMRecWithAdUnitIdentifier:(NSString *)adUnitIdentifier
@@ -548,6 +572,17 @@ static NSString *const TAG = @"MAUnrealPlugin";
     [interstitial setExtraParameterForKey: key value: value];
 }
 
+// The plugin holds the only reference to the interstitial, so dropping it releases the loaded ad. The next load creates a new one.
+- (void)destroyInterstitialWithAdUnitIdentifier:(NSString *)adUnitIdentifier
+{
+    MAInterstitialAd *interstitial = self.interstitials[adUnitIdentifier];
+    if ( !interstitial ) return;
+    
+    interstitial.delegate = nil;
+    interstitial.revenueDelegate = nil;
+    [self.interstitials removeObjectForKey: adUnitIdentifier];
+}
+
 #pragma mark - Rewarded
 
 - (void)loadRewardedAdWithAdUnitIdentifier:(NSString *)adUnitIdentifier
@@ -642,6 +677,7 @@ static NSString *const TAG = @"MAUnrealPlugin";
     
     NSMutableDictionary *parameters = [[self errorInfoForError: error] mutableCopy];
     parameters[@"adUnitIdentifier"] = adUnitIdentifier;
+    parameters[@"adUnitHandle"] = [self adUnitHandleForAdUnitIdentifier: adUnitIdentifier];
     
     [self sendUnrealEventWithName: name parameters: parameters];
 }
@@ -1255,18 +1291,74 @@ static NSString *const TAG = @"MAUnrealPlugin";
 
 - (NSDictionary<NSString *, id> *)adInfoForAd:(MAAd *)ad
 {
-    return @{@"adUnitIdentifier" : ad.adUnitIdentifier,
-             @"creativeIdentifier" : ad.creativeIdentifier ?: @"",
-             @"networkName" : ad.networkName,
-             @"placement" : ad.placement ?: @"",
-             @"revenue" : @(ad.revenue)};
+    NSMutableDictionary<NSString *, id> *adInfo = [@{@"adUnitIdentifier" : ad.adUnitIdentifier,
+                                                     @"creativeIdentifier" : ad.creativeIdentifier ?: @"",
+                                                     @"networkName" : ad.networkName,
+                                                     @"placement" : ad.placement ?: @"",
+                                                     @"revenue" : @(ad.revenue)} mutableCopy];
+    adInfo[@"adUnitHandle"] = [self adUnitHandleForAdUnitIdentifier: ad.adUnitIdentifier];
+    
+    return adInfo;
+}
+
+- (nullable NSNumber *)adUnitHandleForAdUnitIdentifier:(NSString *)adUnitIdentifier
+{
+    @synchronized ( self.adUnitHandles )
+    {
+        return self.adUnitHandles[adUnitIdentifier];
+    }
 }
 
 - (NSDictionary<NSString *, id> *)errorInfoForError:(MAError *)error
 {
     return @{@"code" : @(error.code),
              @"message" : error.message ?: @"",
-             @"waterfall" : error.waterfall.description ?: @""};
+             @"waterfallData" : [self waterfallDataForError: error]};
+}
+
+/**
+ * Encodes the waterfall compactly for FAdError, which only parses it if the waterfall is read: a version, the waterfall name, test name and latency,
+ * then one record per network response. Fields are separated by \x1F and records by \x1E.
+ *
+ * NOTE: Must match ParseWaterfall in AdError.cpp in the Unreal plugin and getWaterfallData in MaxUnrealPlugin.java.
+ */
+- (NSString *)waterfallDataForError:(MAError *)error
+{
+    MAAdWaterfallInfo *waterfall = error.waterfall;
+    if ( !waterfall ) return @"";
+    
+    NSMutableString *waterfallData = [NSMutableString stringWithCapacity: 256];
+    [waterfallData appendFormat: @"%d\x1F%@\x1F%@\x1F%lld",
+     ALWaterfallDataVersion,
+     [self sanitizedWaterfallField: waterfall.name],
+     [self sanitizedWaterfallField: waterfall.testName],
+     (long long) (waterfall.latency * 1000)];
+    
+    for ( MANetworkResponseInfo *response in waterfall.networkResponses )
+    {
+        [waterfallData appendFormat: @"\x1E%ld\x1F%d\x1F%lld\x1F%ld\x1F%@\x1F%@",
+         (long) response.adLoadState,
+         response.isBidding ? 1 : 0,
+         (long long) (response.latency * 1000),
+         (long) (response.error ? response.error.code : 0),
+         [self sanitizedWaterfallField: response.mediatedNetwork.name],
+         [self sanitizedWaterfallField: response.error.message]];
+    }
+    
+    return waterfallData;
+}
+
+- (NSString *)sanitizedWaterfallField:(nullable NSString *)value
+{
+    if ( !value ) return @"";
+    
+    return [[value stringByReplacingOccurrencesOfString: @"\x1F" withString: @" "] stringByReplacingOccurrencesOfString: @"\x1E" withString: @" "];
+}
+
+// Positions are sent by Unreal as EAdViewPosition values, the layout code below works with their names
+- (NSString *)adViewPositionForIndex:(int)adViewPosition
+{
+    return adViewPosition >= 0 && adViewPosition < ALAdViewPositionCount ? ALAdViewPositions[adViewPosition] : @"bottom_right";
 }
 
 - (ALConsentFlowUserGeography)userGeographyForString:(NSString *)userGeographyString